@@ -0,0 +1,146 @@
+// Compares deal and score throughput of the packed 1-byte Card against the
+// original string-carrying card (name, value, texture handle).
+//
+// Usage: CardBench [decks]
+
+#include "Card.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// The card as it was before packing: every deal copies a std::string.
+class LegacyCard {
+public:
+    LegacyCard(std::string name, int value, unsigned int textureID)
+        : name(name), value(value), textureID(textureID) {}
+    std::string getName() const { return name; }
+    int getValue() const { return value; }
+    unsigned int getTextureID() const { return textureID; }
+
+private:
+    std::string name;
+    int value;
+    unsigned int textureID;
+};
+
+std::vector<LegacyCard> makeLegacyDeck() {
+    std::vector<LegacyCard> deck;
+    for (int suit = 0; suit < Card::kSuits; ++suit) {
+        for (int rank = 0; rank < Card::kRanks; ++rank) {
+            Card card(static_cast<Card::Rank>(rank), static_cast<Card::Suit>(suit));
+            deck.emplace_back(card.getName(), card.getValue(), static_cast<unsigned int>(card.getIndex() + 1));
+        }
+    }
+    return deck;
+}
+
+std::vector<Card> makePackedDeck() {
+    std::vector<Card> deck;
+    for (int suit = 0; suit < Card::kSuits; ++suit) {
+        for (int rank = 0; rank < Card::kRanks; ++rank) {
+            deck.emplace_back(static_cast<Card::Rank>(rank), static_cast<Card::Suit>(suit));
+        }
+    }
+    return deck;
+}
+
+template <typename CardT>
+int calculateScore(const std::vector<CardT>& hand) {
+    int score = 0;
+    int aceCount = 0;
+    for (const auto& card : hand) {
+        score += card.getValue();
+        if (card.getValue() == 11) ++aceCount;
+    }
+    while (score > 21 && aceCount > 0) {
+        score -= 10;
+        --aceCount;
+    }
+    return score;
+}
+
+struct Result {
+    double dealsPerSec;
+    double scoresPerSec;
+    long long checksum;
+};
+
+// Deals every deck out in 3-card hands the way dealCard does (push_back of
+// deck.back(), then pop_back), then scores the dealt hands repeatedly.
+template <typename CardT>
+Result run(const std::vector<CardT>& master, int decks) {
+    std::vector<CardT> deck;
+    std::vector<std::vector<CardT>> hands(master.size() / 3);
+    deck.reserve(master.size());
+    for (auto& hand : hands) hand.reserve(8);
+
+    long long checksum = 0;
+    long long deals = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int d = 0; d < decks; ++d) {
+        deck = master;
+        for (auto& hand : hands) {
+            hand.clear();
+            for (int i = 0; i < 3; ++i) {
+                hand.push_back(deck.back());
+                deck.pop_back();
+            }
+        }
+        deals += static_cast<long long>(hands.size()) * 3;
+        checksum += hands.back().size();
+    }
+    auto mid = std::chrono::steady_clock::now();
+
+    long long scores = 0;
+    for (int d = 0; d < decks; ++d) {
+        for (const auto& hand : hands) {
+            checksum += calculateScore(hand);
+        }
+        scores += static_cast<long long>(hands.size());
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double dealSeconds = std::chrono::duration<double>(mid - start).count();
+    double scoreSeconds = std::chrono::duration<double>(end - mid).count();
+    return { deals / dealSeconds, scores / scoreSeconds, checksum };
+}
+
+}
+
+int main(int argc, char** argv) {
+    int decks = argc > 1 ? std::atoi(argv[1]) : 200000;
+
+    std::mt19937 rng(42);
+    std::vector<LegacyCard> legacyDeck = makeLegacyDeck();
+    std::vector<Card> packedDeck = makePackedDeck();
+
+    // Same permutation for both so the checksums must agree
+    std::vector<int> order(Card::kDeckSize);
+    for (int i = 0; i < Card::kDeckSize; ++i) order[i] = i;
+    std::shuffle(order.begin(), order.end(), rng);
+    std::vector<LegacyCard> legacyShuffled;
+    std::vector<Card> packedShuffled;
+    for (int i : order) {
+        legacyShuffled.push_back(legacyDeck[i]);
+        packedShuffled.push_back(packedDeck[i]);
+    }
+
+    Result legacy = run(legacyShuffled, decks);
+    Result packed = run(packedShuffled, decks);
+
+    std::cout << "sizeof(LegacyCard): " << sizeof(LegacyCard) << " bytes, sizeof(Card): " << sizeof(Card) << " bytes" << std::endl;
+    std::cout << "Legacy card  deals/sec: " << legacy.dealsPerSec << "  scores/sec: " << legacy.scoresPerSec << std::endl;
+    std::cout << "Packed card  deals/sec: " << packed.dealsPerSec << "  scores/sec: " << packed.scoresPerSec << std::endl;
+    std::cout << "Speedup      deal: " << packed.dealsPerSec / legacy.dealsPerSec << "x  score: " << packed.scoresPerSec / legacy.scoresPerSec << "x" << std::endl;
+    if (legacy.checksum != packed.checksum) {
+        std::cerr << "Checksum mismatch: " << legacy.checksum << " vs " << packed.checksum << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,63 @@
+// Exact dealer outcome tables and query latency, cold and cached.
+//
+// Usage: DealerOddsBench [decks]
+
+#include "DealerOdds.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+int main(int argc, char** argv) {
+    int decks = argc > 1 ? std::atoi(argv[1]) : 1;
+    if (decks < 1 || decks > DeckComposition::kMaxDecks) {
+        std::cerr << "decks must be 1-" << DeckComposition::kMaxDecks << std::endl;
+        return 1;
+    }
+
+    DealerOdds odds;
+    DeckComposition shoe = DeckComposition::fullDecks(decks);
+    static const char* upNames[] = { "A", "2", "3", "4", "5", "6", "7", "8", "9", "T" };
+
+    std::cout << decks << " deck(s), dealer stands on all 17s" << std::endl;
+    std::cout << "Up     17      18      19      20      21     Bust  Exhaust   cold us" << std::endl;
+    std::cout << std::fixed;
+    for (int up = 0; up < DeckComposition::kRanks; ++up) {
+        DeckComposition remaining = shoe;
+        remaining.remove(up);
+
+        auto start = std::chrono::steady_clock::now();
+        const DealerDistribution& dist = odds.distribution(up, remaining);
+        auto end = std::chrono::steady_clock::now();
+
+        double sum = 0.0;
+        std::cout << std::setw(2) << upNames[up] << std::setprecision(4);
+        for (int outcome = 0; outcome < DealerDistribution::kOutcomes; ++outcome) {
+            std::cout << "  " << std::setw(6) << dist.p[outcome];
+            sum += dist.p[outcome];
+        }
+        std::cout << std::setprecision(1) << "  " << std::setw(8) << std::chrono::duration<double, std::micro>(end - start).count() << std::endl;
+        if (std::fabs(sum - 1.0) > 1e-9) {
+            std::cerr << "Distribution for " << upNames[up] << " sums to " << sum << std::endl;
+            return 1;
+        }
+    }
+
+    // Warm queries: the same compositions come straight from the cache
+    const int repeats = 100000;
+    double sink = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeats; ++i) {
+        int up = i % DeckComposition::kRanks;
+        DeckComposition remaining = shoe;
+        remaining.remove(up);
+        sink += odds.distribution(up, remaining).bust();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout << std::setprecision(3);
+    std::cout << "Cached query: " << std::chrono::duration<double, std::micro>(end - start).count() / repeats
+              << " us (" << odds.cacheSize() << " states cached, checksum " << sink << ")" << std::endl;
+    return 0;
+}
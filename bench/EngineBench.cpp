@@ -0,0 +1,46 @@
+// Headless engine benchmark: plays full rounds without a window or GL context
+// and reports rounds per second.
+//
+// Usage: EngineBench [rounds] [seed]
+
+#include "BlackjackEngine.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+int main(int argc, char** argv) {
+    unsigned long long rounds = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000ULL;
+    unsigned int seed = argc > 2 ? static_cast<unsigned int>(std::strtoul(argv[2], nullptr, 10)) : 12345u;
+
+    BlackjackEngine engine(seed);
+    unsigned long long wins = 0, losses = 0, ties = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long long i = 0; i < rounds; ++i) {
+        engine.startRound();
+
+        // Player mirrors the dealer: hit below 17
+        while (engine.getState() == RoundState::PlayerTurn &&
+               engine.getPlayerHand().getScore() < 17) {
+            engine.hit();
+        }
+        engine.stand();
+        engine.playDealer();
+
+        switch (engine.getResult()) {
+        case RoundResult::PlayerWins: ++wins; break;
+        case RoundResult::DealerWins: ++losses; break;
+        case RoundResult::Tie: ++ties; break;
+        default: break;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    std::cout << "Rounds:      " << rounds << std::endl;
+    std::cout << "Time:        " << seconds << " s" << std::endl;
+    std::cout << "Rounds/sec:  " << static_cast<double>(rounds) / seconds << std::endl;
+    std::cout << "Player wins: " << wins << ", Dealer wins: " << losses << ", Ties: " << ties << std::endl;
+    std::cout << "Deck resets: " << engine.getDeckResets() << std::endl;
+    return 0;
+}
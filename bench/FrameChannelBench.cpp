@@ -0,0 +1,155 @@
+// Throughput of each side of FrameChannel. A logic thread auto-plays a
+// table and publishes a snapshot after every action while a render thread
+// takes the newest one and spends a fixed time "drawing" it. Reports
+// snapshots published per second and how many publishes stalled, first with no
+// renderer, then with the slow renderer on the channel, then with the same
+// renderer holding a lock on shared state while it draws, the way logic
+// and rendering share the table when they cannot run apart. Every snapshot
+// taken is checked for tearing, and sequence numbers must only grow.
+//
+// Usage: FrameChannelBench [seconds per phase] [render ms]
+
+#include "FrameChannel.h"
+#include "TableWall.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const double kStallMicroseconds = 1000.0; // A publish this slow would hold up input
+
+struct Throughput {
+    unsigned long long published = 0;
+    unsigned long long stalls = 0;
+};
+
+// What Game::publishFrame copies out, plus the snapshot's own sequence
+// number as the message so a torn read shows up
+void fill(FrameSnapshot& frame, const BlackjackEngine& engine, unsigned long long sequence) {
+    frame.player = engine.getPlayerHand();
+    frame.dealer = engine.getDealerHand();
+    frame.holeCardHidden = !engine.isDealerRevealed();
+    frame.playerScore = frame.player.getScore();
+    frame.dealerScore = frame.holeCardHidden ? frame.dealer.front().getValue() : frame.dealer.getScore();
+    std::string message = std::to_string(sequence);
+    std::memcpy(frame.message, message.c_str(), message.size() + 1);
+    frame.buttonEnabled[FrameSnapshot::Stand] = engine.getState() == RoundState::PlayerTurn;
+}
+
+bool consistent(const FrameSnapshot& frame) {
+    int dealerScore = frame.holeCardHidden ? frame.dealer.front().getValue() : frame.dealer.getScore();
+    return frame.player.getScore() == frame.playerScore && dealerScore == frame.dealerScore &&
+           std::to_string(frame.sequence) == frame.message;
+}
+
+// Publishes until `seconds` pass; `publish` fills and sends one snapshot
+template <typename Publish>
+Throughput runLogic(double seconds, Publish&& publish) {
+    BlackjackEngine engine(11);
+    engine.startRound();
+    Throughput result;
+    auto end = Clock::now() + std::chrono::duration<double>(seconds);
+    while (Clock::now() < end) {
+        stepDemoTable(engine);
+        auto start = Clock::now();
+        publish(engine, ++result.published);
+        if (std::chrono::duration<double, std::micro>(Clock::now() - start).count() > kStallMicroseconds) ++result.stalls;
+    }
+    return result;
+}
+
+void report(const char* name, const Throughput& logic, double seconds, unsigned long long rendered) {
+    std::cout << name << logic.published / seconds / 1e6 << " M snapshots/sec published, " << logic.stalls
+              << " over 1 ms, " << rendered / seconds << " frames/sec rendered" << std::endl;
+}
+
+}
+
+int main(int argc, char** argv) {
+    double seconds = argc > 1 ? std::atof(argv[1]) : 1.0;
+    double renderMs = argc > 2 ? std::atof(argv[2]) : 8.0;
+    if (seconds <= 0.0 || renderMs < 0.0) {
+        std::cerr << "Usage: FrameChannelBench [seconds per phase] [render ms]" << std::endl;
+        return 1;
+    }
+    auto renderTime = std::chrono::duration<double, std::milli>(renderMs);
+    bool ok = true;
+
+    // Logic alone: the ceiling for the other two
+    {
+        FrameChannel channel;
+        Throughput logic = runLogic(seconds, [&](const BlackjackEngine& engine, unsigned long long sequence) {
+            fill(channel.snapshot(), engine, sequence);
+            channel.publish();
+        });
+        report("No renderer:        ", logic, seconds, 0);
+    }
+
+    // Slow renderer behind the channel, plus a fast one to stress the swaps
+    for (int pass = 0; pass < 2; ++pass) {
+        FrameChannel channel;
+        unsigned long long taken = 0, lastSequence = 0;
+        bool torn = false, reordered = false;
+        std::thread renderer([&] {
+            while (const FrameSnapshot* frame = channel.waitLatest()) {
+                torn = torn || !consistent(*frame);
+                reordered = reordered || frame->sequence <= lastSequence;
+                lastSequence = frame->sequence;
+                ++taken;
+                if (pass == 0) std::this_thread::sleep_for(renderTime);
+            }
+        });
+        Throughput logic = runLogic(seconds, [&](const BlackjackEngine& engine, unsigned long long sequence) {
+            fill(channel.snapshot(), engine, sequence);
+            channel.publish();
+        });
+        channel.close();
+        renderer.join();
+
+        FrameChannel::Counters counters = channel.getCounters();
+        report(pass == 0 ? "Channel, slow draw: " : "Channel, no draw:   ", logic, seconds, taken);
+        std::cout << "    " << counters.rendered << " taken, " << counters.dropped << " dropped" << std::endl;
+        if (torn || reordered) {
+            std::cerr << "Render thread saw " << (torn ? "a torn snapshot" : "sequence numbers go back") << std::endl;
+            ok = false;
+        }
+        if (counters.published != logic.published || counters.rendered != taken ||
+            counters.rendered + counters.dropped != lastSequence) {
+            std::cerr << "Counters do not add up: " << counters.published << " published, " << counters.rendered
+                      << " rendered, " << counters.dropped << " dropped, last taken " << lastSequence << std::endl;
+            ok = false;
+        }
+    }
+
+    // Shared state under a lock the renderer holds while it draws
+    {
+        std::mutex mutex;
+        FrameSnapshot shared;
+        std::atomic<bool> done{ false };
+        unsigned long long rendered = 0;
+        std::thread renderer([&] {
+            while (!done) {
+                std::lock_guard<std::mutex> lock(mutex);
+                std::this_thread::sleep_for(renderTime);
+                ++rendered;
+            }
+        });
+        Throughput logic = runLogic(seconds, [&](const BlackjackEngine& engine, unsigned long long sequence) {
+            std::lock_guard<std::mutex> lock(mutex);
+            fill(shared, engine, sequence);
+        });
+        done = true;
+        renderer.join();
+        report("Locked, slow draw:  ", logic, seconds, rendered);
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,136 @@
+// Replays a scripted session through TableSession on a simulated clock: a
+// few rounds played by clicking, with mouse movement between clicks, then
+// a long idle stretch. The ticks, button presses, dirty marking and pacing
+// are Game's own code; only the window's event wait is simulated. Checks that every change to the table is presented, that an
+// idle table presents nothing and wakes only at the idle timeout, and
+// compares frames and wakeups with the old loop that redrew at 60 Hz.
+//
+// Usage: FramePacerBench [rounds] [idle seconds]
+
+#include "TableSession.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+enum class Input { MouseMove, Hit, Stand, Restart };
+
+struct Event {
+    double time;
+    Input input;
+};
+
+// What the screen shows; any difference between wakeups must be presented
+struct Shown {
+    unsigned long long round;
+    int playerCards;
+    int dealerCards;
+    bool revealed;
+
+    bool operator!=(const Shown& other) const {
+        return round != other.round || playerCards != other.playerCards || dealerCards != other.dealerCards ||
+               revealed != other.revealed;
+    }
+};
+
+Shown shown(const BlackjackEngine& engine) {
+    return { engine.getRoundNumber(), engine.getPlayerHand().size(), engine.getDealerHand().size(),
+             engine.isDealerRevealed() };
+}
+
+// Five seconds per round: restart, up to two hits, stand, with the mouse
+// moving ten times a second in between
+std::vector<Event> script(int rounds) {
+    std::vector<Event> events;
+    for (int round = 0; round < rounds; ++round) {
+        double start = 1.0 + round * 5.0;
+        for (int move = 0; move < 40; ++move) events.push_back({ start + move * 0.1 + 0.05, Input::MouseMove });
+        events.push_back({ start, Input::Restart });
+        events.push_back({ start + 1.0, Input::Hit });
+        events.push_back({ start + 2.0, Input::Hit });
+        events.push_back({ start + 3.0, Input::Stand });
+    }
+    std::sort(events.begin(), events.end(), [](const Event& a, const Event& b) { return a.time < b.time; });
+    return events;
+}
+
+}
+
+int main(int argc, char** argv) {
+    int rounds = argc > 1 ? std::atoi(argv[1]) : 20;
+    double idleSeconds = argc > 2 ? std::atof(argv[2]) : 600.0;
+
+    TableSession session(7);
+    session.newRound();
+    const BlackjackEngine& engine = session.getEngine();
+    FramePacer& pacer = session.getPacer();
+    std::vector<Event> events = script(rounds);
+    double activeEnd = 1.0 + rounds * 5.0;
+    double end = activeEnd + idleSeconds;
+
+    double now = 0.0;
+    std::size_t next = 0;
+    unsigned long long wakeups = 0, idleWakeups = 0, idleRendered = 0;
+    Shown presented = shown(engine);
+    bool ok = true;
+    while (now < end) {
+        // glfwWaitEventsTimeout: the next event or the timeout, whichever is first
+        double timeout = pacer.waitTimeout();
+        bool event = next < events.size() && events[next].time <= now + timeout;
+        now = event ? std::max(now, events[next].time) : now + timeout;
+        ++wakeups;
+
+        // Ticks, then the click, then update, as Game::run does. The
+        // scripted player stops hitting at 17, and a hit never starts a round.
+        session.advance(now);
+        if (event) {
+            Input input = events[next++].input;
+            if (input == Input::Restart) session.press(TableSession::Action::Restart);
+            else if (input == Input::Stand) session.press(TableSession::Action::Stand);
+            else if (input == Input::Hit && engine.getState() == RoundState::PlayerTurn &&
+                     engine.getPlayerHand().getScore() < 17) {
+                session.press(TableSession::Action::Hit);
+            }
+        }
+        session.update();
+
+        bool render = pacer.beginFrame();
+        if (shown(engine) != presented && !render) {
+            std::cerr << "At " << now << " s the table changed but no frame was presented" << std::endl;
+            ok = false;
+        }
+        if (render) presented = shown(engine);
+        if (now > activeEnd + 1.0) {
+            ++idleWakeups;
+            idleRendered += render;
+        }
+    }
+
+    const FramePacer::Counters& counters = pacer.getCounters();
+    if (idleRendered != 0) {
+        std::cerr << idleRendered << " frames presented while the table was idle" << std::endl;
+        ok = false;
+    }
+    // One wakeup per idle timeout, give or take the edges
+    unsigned long long idleLimit = static_cast<unsigned long long>(idleSeconds / FramePacer::kIdleTimeout) + 1;
+    if (idleWakeups > idleLimit) {
+        std::cerr << idleWakeups << " wakeups while idle, expected at most " << idleLimit << std::endl;
+        ok = false;
+    }
+    if (counters.rendered + counters.skipped != wakeups) {
+        std::cerr << "Counters cover " << counters.rendered + counters.skipped << " of " << wakeups << " wakeups"
+                  << std::endl;
+        ok = false;
+    }
+
+    double spinFrames = end * 60.0; // The old loop, held to 60 Hz by vsync
+    std::cout << rounds << " rounds then " << idleSeconds << " s idle, " << end << " s simulated" << std::endl;
+    std::cout << "Event-driven: " << counters.rendered << " frames rendered, " << counters.skipped
+              << " wakeups skipped, " << wakeups / end << " wakeups/sec, " << idleWakeups << " wakeups while idle"
+              << std::endl;
+    std::cout << "Spinning:     " << spinFrames << " frames rendered, 60 wakeups/sec ("
+              << spinFrames / counters.rendered << "x the frames)" << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,212 @@
+// Checks GLState against the stub GL and counts what it saves. A long
+// random sequence of state requests, texture deletions and out-of-band GL
+// calls must leave the stub's state exactly as requested after every step.
+// Then one frame of the game's draw sequence is replayed with plain GL
+// calls and through the tracker, and the GL calls of each are compared.
+//
+// Usage: GLStateBench [random steps] [frames]
+
+#include "GLState.h"
+#include "GLStub.h"
+#include "Random.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+namespace {
+
+// What the tracker was last asked for; the stub must always agree
+struct Expected {
+    GLuint program = 0;
+    GLuint textures[GLState::kTextureUnits] = {};
+    GLuint vertexArray = 0;
+    GLuint arrayBuffer = 0;
+    bool blend = false;
+    bool depthTest = false;
+    GLenum blendSource = GL_ONE;
+    GLenum blendDestination = GL_ZERO;
+};
+
+bool matches(const Expected& expected) {
+    const GLStub::State& actual = GLStub::state();
+    for (int unit = 0; unit < GLState::kTextureUnits; ++unit) {
+        if (actual.textures[unit] != expected.textures[unit]) return false;
+    }
+    return actual.program == expected.program && actual.vertexArray == expected.vertexArray &&
+           actual.arrayBuffer == expected.arrayBuffer && actual.blend == expected.blend &&
+           actual.depthTest == expected.depthTest && actual.blendSource == expected.blendSource &&
+           actual.blendDestination == expected.blendDestination;
+}
+
+bool randomSequence(long long steps) {
+    GLState& state = GLState::current();
+    state.invalidate();
+    Expected expected;
+    // Match the stub's defaults, which the tracker does not know about yet
+    state.useProgram(0);
+    for (int unit = 0; unit < GLState::kTextureUnits; ++unit) state.bindTexture(0, unit);
+    state.bindVertexArray(0);
+    state.bindArrayBuffer(0);
+    state.setBlend(false);
+    state.setDepthTest(false);
+    state.setBlendFunc(GL_ONE, GL_ZERO);
+
+    GLuint textures[6];
+    glGenTextures(6, textures);
+    const GLenum factors[] = { GL_ONE, GL_ZERO, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA };
+    SplitMix64 rng(2024);
+    for (long long step = 0; step < steps; ++step) {
+        std::uint64_t draw = rng();
+        unsigned int value = static_cast<unsigned int>(draw >> 8);
+        switch (draw % 10) {
+        case 0: state.useProgram(expected.program = 1 + value % 3); break;
+        case 1:
+        case 2: {
+            int unit = static_cast<int>(value % 3);
+            state.bindTexture(expected.textures[unit] = textures[(value >> 4) % 6], unit);
+            break;
+        }
+        case 3: state.bindVertexArray(expected.vertexArray = value % 3); break;
+        case 4: state.bindArrayBuffer(expected.arrayBuffer = value % 3); break;
+        case 5: state.setBlend(expected.blend = value & 1); break;
+        case 6: state.setDepthTest(expected.depthTest = value & 1); break;
+        case 7:
+            expected.blendSource = factors[value % 4];
+            expected.blendDestination = factors[(value >> 2) % 4];
+            state.setBlendFunc(expected.blendSource, expected.blendDestination);
+            break;
+        case 8: {
+            // Delete a texture and reuse the slot for a fresh one
+            int which = static_cast<int>(value % 6);
+            glDeleteTextures(1, &textures[which]);
+            state.textureDeleted(textures[which]);
+            for (GLuint& bound : expected.textures) {
+                if (bound == textures[which]) bound = 0;
+            }
+            glGenTextures(1, &textures[which]);
+            break;
+        }
+        default:
+            // Something outside the tracker changes GL, then says so
+            if (value % 8 == 0) {
+                glUseProgram(expected.program = 7);
+                glEnable(GL_BLEND);
+                expected.blend = true;
+                state.invalidate();
+            }
+            break;
+        }
+        if (!matches(expected)) {
+            std::cerr << "GL state differs from the requested state at step " << step << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// The draw sequence of Game::render for six cards on the table: cards,
+// three buttons, then all text in one batch
+template <typename Draw>
+void gameFrame(bool tracked, Draw&& draw) {
+    GLState& state = GLState::current();
+    const GLuint cardProgram = 1, textProgram = 2, atlas = 10, glyphs = 11, cardVertices = 20, textVertices = 21;
+    if (tracked) {
+        state.setDepthTest(true);
+        state.setBlend(false);
+        state.useProgram(cardProgram);
+        for (int hand = 0; hand < 2; ++hand) {
+            state.useProgram(cardProgram);
+            state.bindTexture(atlas);
+            state.bindVertexArray(cardVertices);
+            for (int card = 0; card < 3; ++card) draw();
+        }
+        for (int button = 0; button < 3; ++button) {
+            state.useProgram(cardProgram);
+            state.bindTexture(atlas);
+            state.bindVertexArray(cardVertices);
+            draw();
+        }
+        state.setDepthTest(false);
+        state.setBlend(true);
+        state.setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        state.useProgram(textProgram);
+        state.bindVertexArray(textVertices);
+        state.bindTexture(glyphs);
+        draw();
+        state.setBlend(false);
+        return;
+    }
+    // As the game did it before: every call reaches GL, VAOs are unbound
+    // after use, and update() toggles blending for nothing
+    glDisable(GL_DEPTH_TEST);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glDisable(GL_BLEND);
+    glEnable(GL_DEPTH_TEST);
+    glUseProgram(cardProgram);
+    for (int hand = 0; hand < 2; ++hand) {
+        glUseProgram(cardProgram);
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, atlas);
+        glBindVertexArray(cardVertices);
+        for (int card = 0; card < 3; ++card) draw();
+        glBindVertexArray(0);
+    }
+    for (int button = 0; button < 3; ++button) {
+        glUseProgram(cardProgram);
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, atlas);
+        glBindVertexArray(cardVertices);
+        draw();
+        glBindVertexArray(0);
+    }
+    glDisable(GL_DEPTH_TEST);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glUseProgram(textProgram);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, glyphs);
+    glBindVertexArray(textVertices);
+    draw();
+    glBindVertexArray(0);
+    glDisable(GL_BLEND);
+}
+
+}
+
+int main(int argc, char** argv) {
+    long long steps = argc > 1 ? std::atoll(argv[1]) : 1000000;
+    long long frames = argc > 2 ? std::atoll(argv[2]) : 1000000;
+
+    GLStub::install();
+    if (!randomSequence(steps)) return 1;
+    const GLState::Counters& counters = GLState::current().getCounters();
+    std::cout << steps << " random requests: " << counters.issued << " issued, " << counters.elided
+              << " elided, GL state matched after every step" << std::endl;
+
+    auto draw = [] { glDrawArrays(GL_TRIANGLES, 0, 6); };
+    double callsPerFrame[2];
+    for (int tracked = 0; tracked < 2; ++tracked) {
+        GLState::current().invalidate();
+        gameFrame(tracked != 0, draw); // Warm: the first frame sets everything
+        GLStub::reset();
+        GLState::current().resetCounters();
+        auto start = std::chrono::steady_clock::now();
+        for (long long i = 0; i < frames; ++i) gameFrame(tracked != 0, draw);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        const GLStub::Counters& gl = GLStub::counters();
+        callsPerFrame[tracked] = static_cast<double>(gl.calls - gl.drawCalls) / frames;
+        std::cout << (tracked ? "Tracked: " : "Direct:  ") << callsPerFrame[tracked] << " state calls and "
+                  << gl.drawCalls / frames << " draws per frame, " << seconds / frames * 1e9 << " ns per frame";
+        if (tracked) {
+            std::cout << " (" << static_cast<double>(counters.issued) / frames << " issued, "
+                      << static_cast<double>(counters.elided) / frames << " elided)";
+        }
+        std::cout << std::endl;
+    }
+    if (callsPerFrame[1] >= callsPerFrame[0]) {
+        std::cerr << "The tracker did not remove any GL calls" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,368 @@
+#include "GLStub.h"
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace GLStub {
+
+namespace {
+
+Counters stats;
+State current;
+GLuint nextName = 1;
+std::unordered_set<GLuint> textures;
+std::unordered_map<GLuint, std::vector<unsigned char>> buffers;
+std::unordered_map<GLenum, GLuint> boundBuffers;
+std::unordered_map<GLuint, std::string> shaderSources;
+std::unordered_map<GLuint, std::vector<std::string>> programUniforms; // Default-block uniforms of each program
+
+std::vector<unsigned char>* boundStorage(GLenum target) {
+    auto found = buffers.find(boundBuffers[target]);
+    return found != buffers.end() ? &found->second : nullptr;
+}
+
+void APIENTRY genTextures(GLsizei n, GLuint* names) {
+    ++stats.calls;
+    for (GLsizei i = 0; i < n; ++i) {
+        names[i] = nextName++;
+        textures.insert(names[i]);
+    }
+    stats.liveTextures = static_cast<int>(textures.size());
+}
+
+void APIENTRY deleteTextures(GLsizei n, const GLuint* names) {
+    ++stats.calls;
+    for (GLsizei i = 0; i < n; ++i) {
+        textures.erase(names[i]);
+        for (GLuint& bound : current.textures) {
+            if (bound == names[i]) bound = 0;
+        }
+    }
+    stats.liveTextures = static_cast<int>(textures.size());
+}
+
+void APIENTRY bindTexture(GLenum, GLuint texture) {
+    ++stats.calls;
+    ++stats.textureBinds;
+    current.textures[current.activeTexture - GL_TEXTURE0] = texture;
+}
+
+void APIENTRY activeTexture(GLenum unit) {
+    ++stats.calls;
+    current.activeTexture = unit;
+}
+
+void APIENTRY texImage2D(GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, const void*) {
+    ++stats.calls;
+    ++stats.textureUploads;
+}
+
+void APIENTRY texSubImage2D(GLenum, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, const void*) {
+    ++stats.calls;
+    ++stats.textureUploads;
+}
+
+void APIENTRY genBuffers(GLsizei n, GLuint* names) {
+    ++stats.calls;
+    for (GLsizei i = 0; i < n; ++i) {
+        names[i] = nextName++;
+        buffers[names[i]];
+    }
+    stats.liveBuffers = static_cast<int>(buffers.size());
+}
+
+void APIENTRY deleteBuffers(GLsizei n, const GLuint* names) {
+    ++stats.calls;
+    for (GLsizei i = 0; i < n; ++i) buffers.erase(names[i]);
+    stats.liveBuffers = static_cast<int>(buffers.size());
+}
+
+void APIENTRY bindBuffer(GLenum target, GLuint buffer) {
+    ++stats.calls;
+    boundBuffers[target] = buffer;
+    if (target == GL_ARRAY_BUFFER) current.arrayBuffer = buffer;
+}
+
+void APIENTRY bindVertexArray(GLuint vertexArray) {
+    ++stats.calls;
+    current.vertexArray = vertexArray;
+}
+
+void APIENTRY useProgram(GLuint program) {
+    ++stats.calls;
+    current.program = program;
+}
+
+void APIENTRY enable(GLenum capability) {
+    ++stats.calls;
+    if (capability == GL_BLEND) current.blend = true;
+    if (capability == GL_DEPTH_TEST) current.depthTest = true;
+}
+
+void APIENTRY disable(GLenum capability) {
+    ++stats.calls;
+    if (capability == GL_BLEND) current.blend = false;
+    if (capability == GL_DEPTH_TEST) current.depthTest = false;
+}
+
+void APIENTRY blendFunc(GLenum source, GLenum destination) {
+    ++stats.calls;
+    current.blendSource = source;
+    current.blendDestination = destination;
+}
+
+void APIENTRY bufferData(GLenum target, GLsizeiptr size, const void* data, GLenum) {
+    ++stats.calls;
+    if (std::vector<unsigned char>* storage = boundStorage(target)) {
+        storage->assign(static_cast<size_t>(size), 0);
+        if (data) {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            storage->assign(bytes, bytes + size);
+        }
+    }
+    if (data) {
+        ++stats.bufferUploads;
+        stats.uploadBytes += static_cast<unsigned long long>(size);
+    }
+}
+
+void APIENTRY bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data) {
+    ++stats.calls;
+    ++stats.bufferUploads;
+    stats.uploadBytes += static_cast<unsigned long long>(size);
+    std::vector<unsigned char>* storage = boundStorage(target);
+    if (storage && static_cast<size_t>(offset + size) <= storage->size()) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        std::copy(bytes, bytes + size, storage->begin() + offset);
+    }
+}
+
+void* APIENTRY mapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    ++stats.calls;
+    if (access & GL_MAP_WRITE_BIT) {
+        ++stats.bufferUploads;
+        stats.uploadBytes += static_cast<unsigned long long>(length);
+    }
+    std::vector<unsigned char>* storage = boundStorage(target);
+    if (!storage || static_cast<size_t>(offset + length) > storage->size()) return nullptr;
+    return storage->data() + offset;
+}
+
+GLboolean APIENTRY unmapBuffer(GLenum) {
+    ++stats.calls;
+    return GL_TRUE;
+}
+
+void APIENTRY genVertexArrays(GLsizei n, GLuint* names) {
+    ++stats.calls;
+    for (GLsizei i = 0; i < n; ++i) names[i] = nextName++;
+}
+
+void APIENTRY drawArrays(GLenum, GLint, GLsizei) {
+    ++stats.calls;
+    ++stats.drawCalls;
+}
+
+void APIENTRY drawArraysInstanced(GLenum, GLint, GLsizei, GLsizei) {
+    ++stats.calls;
+    ++stats.drawCalls;
+}
+
+void APIENTRY drawElements(GLenum, GLsizei, GLenum, const void*) {
+    ++stats.calls;
+    ++stats.drawCalls;
+}
+
+void APIENTRY drawElementsBaseVertex(GLenum, GLsizei, GLenum, const void*, GLint) {
+    ++stats.calls;
+    ++stats.drawCalls;
+}
+
+void APIENTRY deleteVertexArrays(GLsizei, const GLuint*) {
+    ++stats.calls;
+}
+
+GLuint APIENTRY createObject() {
+    ++stats.calls;
+    return nextName++;
+}
+
+GLuint APIENTRY createShader(GLenum) {
+    return createObject();
+}
+
+void APIENTRY getStatus(GLuint, GLenum, GLint* value) {
+    ++stats.calls;
+    *value = GL_TRUE;
+}
+
+void APIENTRY shaderSource(GLuint shader, GLsizei count, const GLchar* const* strings, const GLint* lengths) {
+    ++stats.calls;
+    std::string& source = shaderSources[shader];
+    source.clear();
+    for (GLsizei i = 0; i < count; ++i) {
+        if (lengths && lengths[i] >= 0) source.append(strings[i], static_cast<size_t>(lengths[i]));
+        else source.append(strings[i]);
+    }
+}
+
+// Reflection good enough for the game's shaders: every `uniform TYPE NAME;`
+// line is an active uniform, `uniform BLOCK {` lines open a uniform block
+void APIENTRY attachShader(GLuint program, GLuint shader) {
+    ++stats.calls;
+    std::istringstream lines(shaderSources[shader]);
+    std::string line;
+    while (std::getline(lines, line)) {
+        std::istringstream words(line);
+        std::string keyword, type, name;
+        if (!(words >> keyword >> type >> name) || keyword != "uniform" || line.find('{') != std::string::npos) continue;
+        name = name.substr(0, name.find(';'));
+        if (name.find('[') != std::string::npos) name = name.substr(0, name.find('[')) + "[0]"; // Arrays report element 0
+        std::vector<std::string>& uniforms = programUniforms[program];
+        if (std::find(uniforms.begin(), uniforms.end(), name) == uniforms.end()) uniforms.push_back(name);
+    }
+}
+
+void APIENTRY getProgramiv(GLuint program, GLenum name, GLint* value) {
+    ++stats.calls;
+    const std::vector<std::string>& uniforms = programUniforms[program];
+    if (name == GL_ACTIVE_UNIFORMS) *value = static_cast<GLint>(uniforms.size());
+    else if (name == GL_ACTIVE_UNIFORM_MAX_LENGTH) {
+        size_t longest = 0;
+        for (const std::string& uniform : uniforms) longest = std::max(longest, uniform.size());
+        *value = static_cast<GLint>(longest + 1);
+    }
+    else *value = GL_TRUE;
+}
+
+void APIENTRY getActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLint* size, GLenum* type,
+                               GLchar* name) {
+    ++stats.calls;
+    const std::string& uniform = programUniforms[program].at(index);
+    GLsizei copied = std::min(static_cast<GLsizei>(uniform.size()), bufSize - 1);
+    std::memcpy(name, uniform.data(), static_cast<size_t>(copied));
+    name[copied] = 0;
+    if (length) *length = copied;
+    *size = 1;
+    *type = GL_FLOAT;
+}
+
+GLuint APIENTRY getUniformBlockIndex(GLuint, const GLchar*) {
+    ++stats.calls;
+    return 0;
+}
+
+void APIENTRY uniformBlockBinding(GLuint, GLuint, GLuint) { ++stats.calls; }
+void APIENTRY bindBufferBase(GLenum, GLuint, GLuint) { ++stats.calls; }
+
+GLint APIENTRY getUniformLocation(GLuint, const GLchar* name) {
+    ++stats.calls;
+    ++stats.uniformLookups;
+    GLint hash = 0;
+    while (*name) hash = (hash * 31 + *name++) & 0xFFFF;
+    return hash;
+}
+
+void APIENTRY uniform1i(GLint, GLint) { ++stats.calls; ++stats.uniformSets; }
+void APIENTRY uniform3f(GLint, GLfloat, GLfloat, GLfloat) { ++stats.calls; ++stats.uniformSets; }
+void APIENTRY uniform2f(GLint, GLfloat, GLfloat) { ++stats.calls; ++stats.uniformSets; }
+void APIENTRY uniform4f(GLint, GLfloat, GLfloat, GLfloat, GLfloat) { ++stats.calls; ++stats.uniformSets; }
+void APIENTRY uniform4fv(GLint, GLsizei, const GLfloat*) { ++stats.calls; ++stats.uniformSets; }
+void APIENTRY uniformMatrix4fv(GLint, GLsizei, GLboolean, const GLfloat*) { ++stats.calls; ++stats.uniformSets; }
+
+// Calls with nothing to record beyond the call itself
+void APIENTRY ignoreEnum(GLenum) { ++stats.calls; }
+void APIENTRY ignoreName(GLuint) { ++stats.calls; }
+void APIENTRY ignoreEnumInt(GLenum, GLint) { ++stats.calls; }
+void APIENTRY ignoreTexParameter(GLenum, GLenum, GLint) { ++stats.calls; }
+void APIENTRY ignoreInfoLog(GLuint, GLsizei, GLsizei*, GLchar* log) { ++stats.calls; if (log) *log = 0; }
+void APIENTRY ignoreVertexAttribPointer(GLuint, GLint, GLenum, GLboolean, GLsizei, const void*) { ++stats.calls; }
+void APIENTRY ignoreVertexAttribIPointer(GLuint, GLint, GLenum, GLsizei, const void*) { ++stats.calls; }
+void APIENTRY ignoreNameName(GLuint, GLuint) { ++stats.calls; }
+void APIENTRY ignoreColor(GLfloat, GLfloat, GLfloat, GLfloat) { ++stats.calls; }
+void APIENTRY ignoreBitfield(GLbitfield) { ++stats.calls; }
+
+}
+
+void install() {
+    glad_glGenTextures = genTextures;
+    glad_glDeleteTextures = deleteTextures;
+    glad_glBindTexture = bindTexture;
+    glad_glTexParameteri = ignoreTexParameter;
+    glad_glTexImage2D = texImage2D;
+    glad_glTexSubImage2D = texSubImage2D;
+    glad_glGenerateMipmap = ignoreEnum;
+    glad_glPixelStorei = ignoreEnumInt;
+    glad_glActiveTexture = activeTexture;
+
+    glad_glGenBuffers = genBuffers;
+    glad_glDeleteBuffers = deleteBuffers;
+    glad_glBindBuffer = bindBuffer;
+    glad_glBufferData = bufferData;
+    glad_glBufferSubData = bufferSubData;
+    glad_glMapBufferRange = mapBufferRange;
+    glad_glUnmapBuffer = unmapBuffer;
+    glad_glGenVertexArrays = genVertexArrays;
+    glad_glBindVertexArray = bindVertexArray;
+    glad_glEnableVertexAttribArray = ignoreName;
+    glad_glVertexAttribPointer = ignoreVertexAttribPointer;
+    glad_glVertexAttribIPointer = ignoreVertexAttribIPointer;
+    glad_glVertexAttribDivisor = ignoreNameName;
+    glad_glDrawArrays = drawArrays;
+    glad_glDrawArraysInstanced = drawArraysInstanced;
+    glad_glDrawElements = drawElements;
+    glad_glDrawElementsBaseVertex = drawElementsBaseVertex;
+    glad_glDeleteVertexArrays = deleteVertexArrays;
+
+    glad_glCreateShader = createShader;
+    glad_glShaderSource = shaderSource;
+    glad_glCompileShader = ignoreName;
+    glad_glGetShaderiv = getStatus;
+    glad_glGetShaderInfoLog = ignoreInfoLog;
+    glad_glCreateProgram = createObject;
+    glad_glDeleteProgram = ignoreName;
+    glad_glAttachShader = attachShader;
+    glad_glLinkProgram = ignoreName;
+    glad_glGetProgramiv = getProgramiv;
+    glad_glGetActiveUniform = getActiveUniform;
+    glad_glGetUniformBlockIndex = getUniformBlockIndex;
+    glad_glUniformBlockBinding = uniformBlockBinding;
+    glad_glBindBufferBase = bindBufferBase;
+    glad_glGetProgramInfoLog = ignoreInfoLog;
+    glad_glDeleteShader = ignoreName;
+    glad_glUseProgram = useProgram;
+    glad_glGetUniformLocation = getUniformLocation;
+    glad_glUniform1i = uniform1i;
+    glad_glUniform3f = uniform3f;
+    glad_glUniform2f = uniform2f;
+    glad_glUniform4f = uniform4f;
+    glad_glUniform4fv = uniform4fv;
+    glad_glUniformMatrix4fv = uniformMatrix4fv;
+
+    glad_glEnable = enable;
+    glad_glDisable = disable;
+    glad_glBlendFunc = blendFunc;
+    glad_glClearColor = ignoreColor;
+    glad_glClear = ignoreBitfield;
+    reset();
+}
+
+void reset() {
+    stats = Counters();
+    stats.liveTextures = static_cast<int>(textures.size());
+    stats.liveBuffers = static_cast<int>(buffers.size());
+}
+
+const Counters& counters() {
+    return stats;
+}
+
+const State& state() {
+    return current;
+}
+
+}
@@ -0,0 +1,47 @@
+#ifndef GL_STUB_H
+#define GL_STUB_H
+
+#include <cstddef>
+#include <glad/glad.h>
+
+// A fake GL for headless benchmarks and checks. install() points glad's
+// function pointers at recording stubs, so game code that talks to GL runs
+// without a context and its calls can be counted afterwards. Buffers get
+// real CPU storage so mapped writes land somewhere; shaders always compile,
+// and their `uniform` declarations are reported as active uniforms.
+namespace GLStub {
+
+struct Counters {
+    unsigned long long calls = 0;          // Every stubbed GL call
+    unsigned long long textureUploads = 0; // glTexImage2D / glTexSubImage2D
+    unsigned long long textureBinds = 0;
+    unsigned long long bufferUploads = 0;  // glBufferData with data, glBufferSubData, mapped writes
+    unsigned long long uploadBytes = 0;    // Bytes sent by those uploads
+    unsigned long long drawCalls = 0;      // glDrawArrays[Instanced] / glDrawElements[BaseVertex]
+    unsigned long long uniformSets = 0;    // glUniform*
+    unsigned long long uniformLookups = 0; // glGetUniformLocation
+    int liveTextures = 0;                  // Generated and not yet deleted
+    int liveBuffers = 0;
+};
+
+// Bindings and switches as the stub last set them
+struct State {
+    GLuint program = 0;
+    GLenum activeTexture = GL_TEXTURE0;
+    GLuint textures[8] = {};    // GL_TEXTURE_2D per unit
+    GLuint vertexArray = 0;
+    GLuint arrayBuffer = 0;
+    bool blend = false;
+    bool depthTest = false;
+    GLenum blendSource = GL_ONE;
+    GLenum blendDestination = GL_ZERO;
+};
+
+void install();
+void reset();               // Zeroes the counters; GL objects and State persist
+const Counters& counters();
+const State& state();
+
+}
+
+#endif
@@ -0,0 +1,95 @@
+// Batched SoA hand scoring versus the per-hand scalar calculateScore the
+// game used to run on std::vector<Card>.
+//
+// Usage: HandBatchBench [hands] [iterations]
+
+#include "HandBatch.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+int calculateScore(const std::vector<Card>& hand) {
+    int score = 0;
+    int aceCount = 0;
+    for (const auto& card : hand) {
+        score += card.getValue();
+        if (card.getValue() == 11) ++aceCount;
+    }
+    while (score > 21 && aceCount > 0) {
+        score -= 10;
+        --aceCount;
+    }
+    return score;
+}
+
+template <typename Fn>
+double handsPerSecond(size_t hands, int iterations, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) fn();
+    auto end = std::chrono::steady_clock::now();
+    return static_cast<double>(hands) * iterations / std::chrono::duration<double>(end - start).count();
+}
+
+}
+
+int main(int argc, char** argv) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : (1u << 20);
+    int iterations = argc > 2 ? std::atoi(argv[2]) : 20;
+
+    // Deal hands of 2-7 cards from freshly shuffled decks
+    std::mt19937 rng(2024);
+    std::vector<Card> deck;
+    for (int i = 0; i < Card::kDeckSize; ++i) {
+        deck.emplace_back(static_cast<Card::Rank>(i % Card::kRanks), static_cast<Card::Suit>(i / Card::kRanks));
+    }
+    std::uniform_int_distribution<int> sizes(2, 7);
+
+    std::vector<std::vector<Card>> vectors(count);
+    HandBatch batch(count);
+    for (size_t h = 0; h < count; ++h) {
+        std::shuffle(deck.begin(), deck.end(), rng);
+        Hand hand;
+        int n = sizes(rng);
+        for (int c = 0; c < n; ++c) {
+            vectors[h].push_back(deck[c]);
+            hand.add(deck[c]);
+        }
+        batch.setHand(h, hand);
+    }
+
+    std::vector<int> reference(count);
+    HandBatchScores scalar, simd;
+    long long sink = 0;
+
+    double vectorRate = handsPerSecond(count, iterations, [&] {
+        for (size_t h = 0; h < count; ++h) reference[h] = calculateScore(vectors[h]);
+        sink += reference[count - 1];
+    });
+    double scalarRate = handsPerSecond(count, iterations, [&] {
+        scoreHandsScalar(batch, scalar);
+        sink += scalar.totals[0];
+    });
+    double simdRate = handsPerSecond(count, iterations, [&] {
+        scoreHands(batch, simd);
+        sink += simd.totals[0];
+    });
+
+    for (size_t h = 0; h < count; ++h) {
+        if (reference[h] != scalar.totals[h] || reference[h] != simd.totals[h] || scalar.aceCounts[h] != simd.aceCounts[h]) {
+            std::cerr << "Mismatch at hand " << h << ": " << reference[h] << " / " << int(scalar.totals[h]) << " / " << int(simd.totals[h]) << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "Hands: " << count << " x " << iterations << " iterations (checksum " << sink << ")" << std::endl;
+    std::cout << "calculateScore(vector<Card>): " << vectorRate << " hands/sec" << std::endl;
+    std::cout << "scoreHandsScalar (SoA):       " << scalarRate << " hands/sec" << std::endl;
+    std::cout << "scoreHands (" << scoreHandsKernel() << "):            " << simdRate << " hands/sec ("
+              << simdRate / vectorRate << "x vs calculateScore)" << std::endl;
+    return 0;
+}
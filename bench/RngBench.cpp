@@ -0,0 +1,89 @@
+// Shuffles/sec of an 8-deck shoe for each RNG backend, plus the old
+// std::mt19937 + std::shuffle path for reference.
+//
+// Usage: RngBench [shuffles] [decks]
+
+#include "Random.h"
+#include "Shoe.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+template <typename Fn>
+double perSecond(long long count, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto end = std::chrono::steady_clock::now();
+    return count / std::chrono::duration<double>(end - start).count();
+}
+
+template <typename Rng>
+void report(const char* name, Rng rng, long long shuffles, int decks) {
+    Shoe shoe(decks);
+    long long checksum = 0;
+    double shuffleRate = perSecond(shuffles, [&] {
+        for (long long i = 0; i < shuffles; ++i) {
+            shoe.shuffle(rng);
+            checksum += shoe.deal().getIndex();
+        }
+    });
+    const long long draws = 50000000;
+    double drawRate = perSecond(draws, [&] {
+        for (long long i = 0; i < draws; ++i) checksum += next32(rng);
+    });
+    std::cout << name << shuffleRate << " shuffles/sec, " << drawRate / 1e6 << " M draws/sec, "
+              << sizeof(Rng) << " bytes of state (checksum " << checksum << ")" << std::endl;
+}
+
+// Philox4x32-10 known-answer vectors from the Random123 distribution.
+bool philoxKnownAnswers() {
+    const std::uint32_t zero[4] = { 0, 0, 0, 0 };
+    const std::uint32_t zeroKey[2] = { 0, 0 };
+    const std::uint32_t ones[4] = { 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu };
+    const std::uint32_t onesKey[2] = { 0xFFFFFFFFu, 0xFFFFFFFFu };
+    const std::uint32_t expectZero[4] = { 0x6627E8D5u, 0xE169C58Du, 0xBC57AC4Cu, 0x9B00DBD8u };
+    const std::uint32_t expectOnes[4] = { 0x408F276Du, 0x41C83B0Eu, 0xA20BC7C6u, 0x6D5451FDu };
+    std::uint32_t out[4];
+    Philox4x32::generate(zero, zeroKey, out);
+    if (!std::equal(out, out + 4, expectZero)) return false;
+    Philox4x32::generate(ones, onesKey, out);
+    return std::equal(out, out + 4, expectOnes);
+}
+
+}
+
+int main(int argc, char** argv) {
+    long long shuffles = argc > 1 ? std::atoll(argv[1]) : 200000;
+    int decks = argc > 2 ? std::atoi(argv[2]) : 8;
+
+    if (!philoxKnownAnswers()) {
+        std::cerr << "Philox4x32-10 does not match the Random123 known-answer vectors" << std::endl;
+        return 1;
+    }
+
+    std::cout << decks << "-deck shoe, " << shuffles << " shuffles per backend" << std::endl;
+
+    {
+        std::mt19937 rng(7);
+        Shoe source(decks);
+        std::vector<Card> cards(source.begin(), source.end());
+        long long checksum = 0;
+        double rate = perSecond(shuffles, [&] {
+            for (long long i = 0; i < shuffles; ++i) {
+                std::shuffle(cards.begin(), cards.end(), rng);
+                checksum += cards.back().getIndex();
+            }
+        });
+        std::cout << "std::mt19937 + std::shuffle: " << rate << " shuffles/sec (checksum " << checksum << ")" << std::endl;
+    }
+    report("std::mt19937:         ", std::mt19937(7), shuffles, decks);
+    report("Xoshiro256StarStar:   ", Xoshiro256StarStar(7), shuffles, decks);
+    report("Pcg32:                ", Pcg32(7), shuffles, decks);
+    report("Philox4x32:           ", Philox4x32(7, 0), shuffles, decks);
+    return 0;
+}
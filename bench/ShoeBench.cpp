@@ -0,0 +1,76 @@
+// Shuffle + deal throughput of an 8-deck Shoe against rebuilding the deck
+// vector on every reset the way Game::resetDeck used to. Both rows shuffle
+// with shuffleCards and the same generator, so only the rebuild differs.
+//
+// Usage: ShoeBench [shoes] [decks] [penetration]
+
+#include "Shoe.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct Rate {
+    double shoesPerSec;
+    double cardsPerSec;
+};
+
+Rate measure(long long shoes, long long cards, std::chrono::steady_clock::time_point start) {
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return { shoes / seconds, cards / seconds };
+}
+
+}
+
+int main(int argc, char** argv) {
+    long long shoes = argc > 1 ? std::atoll(argv[1]) : 200000;
+    int decks = argc > 2 ? std::atoi(argv[2]) : 8;
+    double penetration = argc > 3 ? std::atof(argv[3]) : 0.75;
+
+    std::mt19937 rng(99);
+    long long checksum = 0;
+
+    // Rebuild, shuffle, deal to the cut with pop_back
+    long long legacyCards = 0;
+    std::vector<Card> deck;
+    auto start = std::chrono::steady_clock::now();
+    for (long long s = 0; s < shoes; ++s) {
+        deck.clear();
+        for (int d = 0; d < decks; ++d) {
+            for (int suit = 0; suit < Card::kSuits; ++suit) {
+                for (int rank = 0; rank < Card::kRanks; ++rank) {
+                    deck.emplace_back(static_cast<Card::Rank>(rank), static_cast<Card::Suit>(suit));
+                }
+            }
+        }
+        shuffleCards(deck.begin(), deck.end(), rng);
+        size_t cut = deck.size() - static_cast<size_t>(penetration * deck.size());
+        while (deck.size() > cut) {
+            checksum += deck.back().getValue();
+            deck.pop_back();
+            ++legacyCards;
+        }
+    }
+    Rate legacy = measure(shoes, legacyCards, start);
+
+    // In-place reshuffle, deal until the cut card comes out
+    long long shoeCards = 0;
+    Shoe shoe(decks, penetration);
+    start = std::chrono::steady_clock::now();
+    for (long long s = 0; s < shoes; ++s) {
+        shoe.shuffle(rng);
+        while (!shoe.needsShuffle()) {
+            checksum += shoe.deal().getValue();
+            ++shoeCards;
+        }
+    }
+    Rate inPlace = measure(shoes, shoeCards, start);
+
+    std::cout << decks << " decks, penetration " << penetration << ", " << shoes << " shoes (checksum " << checksum << ")" << std::endl;
+    std::cout << "Rebuild + shuffle:   " << legacy.shoesPerSec << " shoes/sec, " << legacy.cardsPerSec << " cards/sec" << std::endl;
+    std::cout << "Shoe (in place):     " << inPlace.shoesPerSec << " shoes/sec, " << inPlace.cardsPerSec << " cards/sec" << std::endl;
+    return 0;
+}
@@ -0,0 +1,131 @@
+// GL traffic and CPU cost of the table's cards and buttons, run against the
+// stub GL. A full table (six cards and three buttons) must go out as one
+// upload and one draw, against nine uniform-driven draws the way
+// Game::renderCards used to issue them. Also checks that mixed programs,
+// textures and layers cost one draw per distinct combination, and that a
+// frame larger than one index range splits cleanly.
+//
+// Usage: SpriteBatchBench [frames]
+
+#include "GLState.h"
+#include "GLStub.h"
+#include "SpriteBatch.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+namespace {
+
+const char* kVertexSource = "uniform mat4 model;\nuniform vec4 uvRect;\n";
+const char* kFragmentSource = "uniform sampler2D texture1;\n";
+
+struct Quad {
+    glm::vec2 center;
+    glm::vec2 size;
+};
+
+// Player and dealer hands of three, then the three buttons, as Game::render places them
+const Quad kTable[] = {
+    { { -0.8f, 0.5f }, { 0.216f, 0.336f } }, { { -0.54f, 0.5f }, { 0.216f, 0.336f } }, { { -0.28f, 0.5f }, { 0.216f, 0.336f } },
+    { { -0.8f, -0.2f }, { 0.216f, 0.336f } }, { { -0.54f, -0.2f }, { 0.216f, 0.336f } }, { { -0.28f, -0.2f }, { 0.216f, 0.336f } },
+    { { -0.75f, -0.8f }, { 0.4f, 0.2f } }, { { -0.25f, -0.8f }, { 0.4f, 0.2f } }, { { 0.25f, -0.8f }, { 0.4f, 0.2f } }
+};
+const int kTableQuads = sizeof(kTable) / sizeof(kTable[0]);
+
+struct PerFrame {
+    double draws, uploads, uploadBytes, uniformSets, calls, microseconds;
+};
+
+template <typename Frame>
+PerFrame measure(long long frames, Frame&& frame) {
+    GLStub::reset();
+    auto start = std::chrono::steady_clock::now();
+    for (long long i = 0; i < frames; ++i) frame();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const GLStub::Counters& gl = GLStub::counters();
+    double n = static_cast<double>(frames);
+    return { gl.drawCalls / n, gl.bufferUploads / n, gl.uploadBytes / n, gl.uniformSets / n, gl.calls / n,
+             seconds / n * 1e6 };
+}
+
+void report(const char* name, const PerFrame& frame) {
+    std::cout << name << frame.draws << " draws, " << frame.uploads << " uploads (" << frame.uploadBytes << " bytes), "
+              << frame.uniformSets << " uniform sets, " << frame.calls << " GL calls, " << frame.microseconds
+              << " us CPU per frame" << std::endl;
+}
+
+}
+
+int main(int argc, char** argv) {
+    long long frames = argc > 1 ? std::atoll(argv[1]) : 200000;
+
+    GLStub::install();
+    Shader cards(kVertexSource, kFragmentSource);
+    Shader other(kVertexSource, kFragmentSource);
+    GLuint textures[2];
+    glGenTextures(2, textures);
+    AtlasRect cell;
+    cell.width = 0.1f;
+    cell.height = 0.1f;
+    bool ok = true;
+
+    // The old path: a model matrix and atlas cell uniform per quad
+    GLuint vertexArray;
+    glGenVertexArrays(1, &vertexArray);
+    GLint modelLocation = cards.getUniformLocation("model");
+    GLint uvRectLocation = cards.getUniformLocation("uvRect");
+    PerFrame direct = measure(frames, [&] {
+        cards.use();
+        GLState::current().bindTexture(textures[0]);
+        GLState::current().bindVertexArray(vertexArray);
+        for (const Quad& quad : kTable) {
+            glUniform4f(uvRectLocation, cell.u, cell.v, cell.width, cell.height);
+            glm::mat4 model = glm::mat4(1.0f);
+            model = glm::translate(model, glm::vec3(quad.center, 0.0f));
+            model = glm::scale(model, glm::vec3(quad.size, 1.0f));
+            glUniformMatrix4fv(modelLocation, 1, GL_FALSE, glm::value_ptr(model));
+            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+        }
+    });
+
+    SpriteBatch batch;
+    batch.create();
+    PerFrame batched = measure(frames, [&] {
+        for (const Quad& quad : kTable) batch.draw(cards, textures[0], quad.center, quad.size, cell);
+        batch.flush();
+    });
+    report("Per quad: ", direct);
+    report("Batched:  ", batched);
+    const size_t tableBytes = kTableQuads * 4 * sizeof(SpriteVertex);
+    if (batched.draws != 1.0 || batched.uploads != 1.0 || batched.uploadBytes != tableBytes ||
+        batch.getFrameStats().drawCalls != 1 || batch.getFrameStats().uploadBytes != tableBytes) {
+        std::cerr << "A table frame was not one draw and one " << tableBytes << "-byte upload" << std::endl;
+        ok = false;
+    }
+
+    // 2 layers x 2 programs x 2 textures, queued interleaved
+    GLStub::reset();
+    for (int i = 0; i < 1000; ++i) {
+        batch.draw(i & 1 ? cards : other, textures[(i >> 1) & 1], glm::vec2(0.0f), glm::vec2(0.1f), cell,
+                   glm::vec4(1.0f), (i >> 2) & 1);
+    }
+    batch.flush();
+    std::cout << "Mixed:    1000 sprites in " << batch.getFrameStats().drawCalls << " draws" << std::endl;
+    if (batch.getFrameStats().drawCalls != 8 || GLStub::counters().drawCalls != 8) ok = false;
+
+    // More quads than 16-bit indices reach
+    const int many = SpriteBatch::kMaxQuadsPerDraw + 1000;
+    GLStub::reset();
+    for (int i = 0; i < many; ++i) batch.draw(cards, textures[0], glm::vec2(0.0f), glm::vec2(0.01f), cell);
+    batch.flush();
+    std::cout << "Large:    " << many << " sprites in " << batch.getFrameStats().drawCalls << " draws, "
+              << batch.getFrameStats().uploadBytes << " bytes" << std::endl;
+    if (batch.getFrameStats().drawCalls != 2 || batch.getFrameStats().uploadBytes != many * 4 * sizeof(SpriteVertex)) {
+        ok = false;
+    }
+
+    batch.destroy();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+// CPU cost and upload traffic of the table wall, run against the stub GL.
+// Hundreds of auto-playing tables feed one TableWall; each frame reports
+// the cards rewritten, the bytes uploaded and the time spent updating the
+// instances, against rebuilding and re-uploading every instance. Checks
+// that the incremental instances always match a wall built from scratch,
+// that each frame is one instanced draw, and that the bytes sent equal
+// the dirty spans.
+//
+// Usage: TableWallBench [tables] [frames]
+
+#include "GLStub.h"
+#include "TableWall.h"
+#include "TableWallRenderer.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+const int kStepFrames = 8; // Each table acts every this many frames, as in Game::tickWall at a tick per frame
+const int kVerifyEvery = 50;
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool sameInstances(const std::vector<CardInstance>& a, const std::vector<CardInstance>& b) {
+    if (a.size() != b.size()) return false;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if (a[i].x != b[i].x || a[i].y != b[i].y || a[i].slot != b[i].slot) return false;
+    }
+    return true;
+}
+
+}
+
+int main(int argc, char** argv) {
+    int tables = argc > 1 ? std::atoi(argv[1]) : 400;
+    long long frames = argc > 2 ? std::atoll(argv[2]) : 5000;
+    if (tables <= 0 || frames <= 0) {
+        std::cerr << "Usage: TableWallBench [tables] [frames]" << std::endl;
+        return 1;
+    }
+
+    GLStub::install();
+    CardAtlas atlas;
+    TableWallRenderer renderer;
+    renderer.create(atlas);
+
+    std::vector<BlackjackEngine> engines;
+    engines.reserve(tables);
+    for (int table = 0; table < tables; ++table) engines.emplace_back(table + 1);
+    TableWall wall;
+    wall.layout(tables);
+    for (int table = 0; table < tables; ++table) wall.update(table, engines[table]);
+
+    const std::size_t fullBytes = wall.getInstances().size() * sizeof(CardInstance);
+    GLStub::reset();
+    renderer.upload(wall);
+    if (renderer.getStats().uploadBytes != fullBytes || GLStub::counters().uploadBytes != fullBytes) {
+        std::cerr << "First upload sent " << GLStub::counters().uploadBytes << " bytes, expected " << fullBytes
+                  << std::endl;
+        return 1;
+    }
+
+    unsigned long long changedTables = 0, uploads = 0, uploadBytes = 0;
+    unsigned long long writesBefore = wall.getCardWrites();
+    double updateSeconds = 0.0, rebuildSeconds = 0.0;
+    long long rebuilds = 0;
+    TableWall rebuilt;
+    for (long long frame = 0; frame < frames; ++frame) {
+        for (int table = 0; table < tables; ++table) {
+            if ((frame + table) % kStepFrames == 0) stepDemoTable(engines[table]);
+        }
+
+        // Timed: the CPU side of the wall each frame, as in Game::updateWall and renderWall
+        GLStub::reset();
+        auto start = std::chrono::steady_clock::now();
+        for (int table = 0; table < tables; ++table) changedTables += wall.update(table, engines[table]);
+        renderer.upload(wall);
+        updateSeconds += secondsSince(start);
+        renderer.draw(wall, 1);
+
+        const TableWallRenderer::Stats& stats = renderer.getStats();
+        const GLStub::Counters& gl = GLStub::counters();
+        if (gl.drawCalls != 1 || stats.drawCalls != 1) {
+            std::cerr << "Frame " << frame << ": " << gl.drawCalls << " draws, expected one instanced draw" << std::endl;
+            return 1;
+        }
+        if (gl.uploadBytes != stats.uploadBytes || gl.bufferUploads != stats.uploads) {
+            std::cerr << "Frame " << frame << ": GL received " << gl.uploadBytes << " bytes in " << gl.bufferUploads
+                      << " uploads, the dirty spans hold " << stats.uploadBytes << " in " << stats.uploads << std::endl;
+            return 1;
+        }
+        uploads += stats.uploads;
+        uploadBytes += stats.uploadBytes;
+
+        if (frame % kVerifyEvery == 0) {
+            start = std::chrono::steady_clock::now();
+            rebuilt.layout(tables);
+            for (int table = 0; table < tables; ++table) rebuilt.update(table, engines[table]);
+            rebuildSeconds += secondsSince(start);
+            ++rebuilds;
+            if (!sameInstances(wall.getInstances(), rebuilt.getInstances())) {
+                std::cerr << "Frame " << frame << ": incremental instances differ from a fresh build" << std::endl;
+                return 1;
+            }
+        }
+    }
+
+    double n = static_cast<double>(frames);
+    std::cout << tables << " tables, " << wall.getInstances().size() << " card instances, " << frames << " frames"
+              << std::endl;
+    std::cout << "Incremental: " << changedTables / n << " tables and " << (wall.getCardWrites() - writesBefore) / n
+              << " cards changed, " << uploads / n << " uploads (" << uploadBytes / n << " bytes), "
+              << updateSeconds / n * 1e6 << " us CPU per frame" << std::endl;
+    std::cout << "Full rebuild: " << tables << " tables, " << fullBytes << " bytes, " << rebuildSeconds / rebuilds * 1e6
+              << " us CPU per frame" << std::endl;
+
+    renderer.destroy();
+    return 0;
+}
@@ -0,0 +1,231 @@
+// GL traffic and CPU cost of one frame of game text, run against the stub
+// GL: the two score lines, the three button labels and a result message.
+// Batched text must reach GL as at most one upload and exactly one draw per
+// frame, however many strings or glyphs were queued, and a frame whose text
+// did not change must upload nothing. No frame may look a uniform up by
+// name, and the projection in the FrameData block is uploaded once. Also reports what drawing one glyph
+// at a time (one 96-byte upload and one draw each) would have cost, and
+// what MeasureText costs per glyph.
+// A localized phase then draws UTF-8 text from outside the baked atlas: its
+// glyphs must be rasterized once, not every frame, and cost one extra draw
+// per glyph page. Finally every Latin, Greek and Cyrillic glyph of the font
+// is cycled through, which must recycle pages rather than grow past the cap,
+// and then drawn all in one frame: the glyphs that find no room show as '?'
+// that frame only.
+//
+// Usage: TextBatchBench [frames] [baked font] [source font]   (run from the build directory)
+
+#include "FrameUniforms.h"
+#include "GLStub.h"
+#include "TextRenderer.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv) {
+    long long frames = argc > 1 ? std::atoll(argv[1]) : 100000;
+    std::string font = argc > 2 ? argv[2] : "assets/fontAtlas.bin";
+    std::string sourceFont = argc > 3 ? argv[3] : "assets/font.ttf";
+
+    GLStub::install();
+    Shader shader("layout (std140) uniform FrameData {\n    mat4 projection;\n};\n",
+                  "uniform sampler2D text;\n");
+    shader.use();
+    shader.setInt("text", 0);
+    FrameUniforms frameUniforms;
+    frameUniforms.create();
+    shader.bindUniformBlock(FrameUniforms::kBlockName, FrameUniforms::kBinding);
+    frameUniforms.update({ glm::ortho(0.0f, 1280.0f, 0.0f, 960.0f) });
+    TextRenderer text(font, 24, sourceFont);
+    // "8zu7pab" shares the FNV-1a hash of "text": absent it must miss,
+    // declared too it must keep a location of its own
+    Shader colliding("uniform sampler2D text;\n", "uniform vec4 8zu7pab;\n");
+    if (!text.IsLoaded() || shader.getUniformCount() != 1 || shader.getUniformLocation("text") < 0 ||
+        shader.getUniformLocation("8zu7pab") != -1 || colliding.getUniformCount() != 2 ||
+        colliding.getUniformLocation("8zu7pab") < 0 ||
+        colliding.getUniformLocation("8zu7pab") == colliding.getUniformLocation("text")) {
+        return 1;
+    }
+
+    const glm::vec3 white(1.0f, 1.0f, 1.0f);
+    std::string playerScore = "Player Score: 0";
+    std::string dealerScore = "Dealer Score: 0";
+    TextFrameStats frame;
+    bool batched = true;
+
+    // Scores change every frame when `changing`, otherwise the text is static
+    auto run = [&](bool changing) {
+        GLStub::reset();
+        unsigned long long uploadedFrames = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (long long i = 0; i < frames; ++i) {
+            const GLStub::Counters before = GLStub::counters();
+            frameUniforms.update({ glm::ortho(0.0f, 1280.0f, 0.0f, 960.0f) });
+            if (changing) {
+                playerScore = "Player Score: " + std::to_string(i % 22);
+                dealerScore = "Dealer Score: " + std::to_string(i % 11);
+            }
+            text.RenderText("HIT", 502.0f, 82.0f, 0.8f, white);
+            text.RenderText("STAND", 182.0f, 82.0f, 0.8f, white);
+            text.RenderText("RESTART", 758.0f, 82.0f, 0.8f, white);
+            text.RenderText(playerScore, 10.0f, 920.0f, 1.0f, white);
+            text.RenderText(dealerScore, 10.0f, 880.0f, 1.0f, white);
+            text.RenderText("PLAYER WINS!", 520.0f, 480.0f, 1.0f, white);
+            text.Flush(shader);
+
+            frame = text.GetFrameStats();
+            const GLStub::Counters& after = GLStub::counters();
+            unsigned long long uploads = after.bufferUploads - before.bufferUploads;
+            uploadedFrames += uploads;
+            if (after.drawCalls - before.drawCalls != 1 || uploads > 1 ||
+                after.uploadBytes - before.uploadBytes != frame.uploadBytes || frame.drawCalls != 1 ||
+                after.uniformLookups != before.uniformLookups) {
+                batched = false;
+            }
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << (changing ? "Changing:  " : "Static:    ") << GLStub::counters().drawCalls / frames << " draw, "
+                  << uploadedFrames << " uploads in " << frames << " frames, "
+                  << GLStub::counters().calls / static_cast<double>(frames) << " GL calls, "
+                  << GLStub::counters().uniformLookups << " uniform lookups, "
+                  << seconds / frames * 1e6 << " us CPU per frame" << std::endl;
+        return uploadedFrames;
+    };
+
+    run(true);
+    std::cout << "Per frame: " << frame.strings << " strings, " << frame.glyphs << " glyphs" << std::endl;
+    // Only the first static frame, which differs from the last changing one, uploads
+    playerScore = "Player Score: 21";
+    dealerScore = "Dealer Score: 10";
+    if (run(false) != 1) batched = false;
+    std::cout << "Per glyph: " << frame.glyphs << " draws, " << frame.glyphs << " uploads of 96 bytes" << std::endl;
+
+    if (frameUniforms.getUploads() != 1) batched = false;
+    if (!batched) {
+        std::cerr << "Text was not drawn with one draw, at most one upload and no uniform lookups per frame" << std::endl;
+        return 1;
+    }
+
+    // Label widths the Game centers with, against the per-character estimates they replaced
+    {
+        const char* labels[] = { "HIT", "STAND", "RESTART", "PLAYER WINS!", "IT'S A TIE!", "DEALER WINS!" };
+        const float scales[] = { 0.8f, 0.8f, 0.8f, 1.0f, 1.0f, 1.0f };
+        const float estimates[] = { 12.0f * 0.8f, 12.0f * 0.8f, 12.0f * 0.8f, 20.0f, 20.0f, 20.0f };
+        double checksum = 0.0;
+        long long measuredGlyphs = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (long long i = 0; i < frames; ++i) {
+            for (int label = 0; label < 6; ++label) checksum += text.MeasureText(labels[label], scales[label]);
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "Measured:";
+        for (int label = 0; label < 6; ++label) {
+            std::string name = labels[label];
+            measuredGlyphs += static_cast<long long>(name.size()) * frames;
+            std::cout << " " << name << " " << text.MeasureText(name, scales[label]) << "px (was "
+                      << name.size() * estimates[label] << ")";
+        }
+        std::cout << std::endl << "MeasureText: " << seconds / measuredGlyphs * 1e9 << " ns per glyph (checksum "
+                  << checksum << ")" << std::endl;
+    }
+
+    // Localized table text; the last string is truncated UTF-8 and must not break layout
+    const char* localized[] = {
+        "Oyuncu Puan\xC4\xB1: 21",                                    // Turkish dotless i
+        "Bank \xC3\xBC" "berkauft!",                                  // German u-umlaut
+        "\xD0\x98\xD0\xB3\xD1\x80\xD0\xBE\xD0\xBA \xD0\xB2\xD1\x8B\xD0\xB8\xD0\xB3\xD1\x80\xD0\xB0\xD0\xBB!", // Russian
+        "\xCE\x9D\xCE\xAF\xCE\xBA\xCE\xB7!",                    // Greek
+        "\xE2\x99\xA0 \xE2\x99\xA5 \xE2\x99\xA6 \xE2\x99\xA3", // Card suits
+        "Broken \xE2\x99"
+    };
+    GlyphCacheStats glyphs = text.GetGlyphStats();
+    auto start = std::chrono::steady_clock::now();
+    unsigned int rasterizedAfterFirst = 0;
+    bool paged = true;
+    for (int i = 0; i < 1000; ++i) {
+        const GLStub::Counters before = GLStub::counters();
+        for (int line = 0; line < 6; ++line) text.RenderText(localized[line], 10.0f, 900.0f - 40.0f * line, 1.0f, white);
+        text.RenderText("HIT", 502.0f, 82.0f, 0.8f, white);
+        text.Flush(shader);
+        if (i == 0) {
+            rasterizedAfterFirst = text.GetGlyphStats().rasterized;
+            std::cout << "Localized: " << rasterizedAfterFirst - glyphs.rasterized << " glyphs rasterized in "
+                      << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count()
+                      << " ms, " << text.GetFrameStats().drawCalls << " draws per frame" << std::endl;
+        }
+        const GLStub::Counters& after = GLStub::counters();
+        if (after.drawCalls - before.drawCalls != text.GetFrameStats().drawCalls ||
+            text.GetFrameStats().drawCalls > 1u + text.GetGlyphStats().pages) {
+            paged = false;
+        }
+    }
+    if (text.GetGlyphStats().rasterized != rasterizedAfterFirst) paged = false;
+
+    // Far more glyphs than the pages hold, a line of 24 per frame
+    std::string line;
+    int lines = 0;
+    for (char32_t codepoint = 0xA0; codepoint < 0x530; ++codepoint) {
+        if (codepoint < 0x800) {
+            line += static_cast<char>(0xC0 | (codepoint >> 6));
+            line += static_cast<char>(0x80 | (codepoint & 0x3F));
+        }
+        if (codepoint % 24 == 23) {
+            text.RenderText(line, 10.0f, 500.0f, 1.0f, white);
+            text.Flush(shader);
+            line.clear();
+            ++lines;
+        }
+    }
+    glyphs = text.GetGlyphStats();
+    std::cout << "Cycled " << lines << " lines: " << glyphs.rasterized << " glyphs rasterized, " << glyphs.pages << " of "
+              << TextRenderer::kMaxGlyphPages << " pages, " << glyphs.evictions << " evictions, " << glyphs.dropped
+              << " dropped, " << glyphs.cached << " resident, " << text.GetTextureBytes() << " texture bytes" << std::endl;
+    if (glyphs.pages > static_cast<unsigned int>(TextRenderer::kMaxGlyphPages) || glyphs.evictions == 0 ||
+        glyphs.dropped != 0) {
+        paged = false;
+    }
+
+    if (!paged) {
+        std::cerr << "Glyphs outside the baked atlas were not cached in a bounded set of pages" << std::endl;
+        return 1;
+    }
+
+    // Every one of those glyphs in a single frame, so the pages fill and the
+    // last lines are laid out with '?'. Drawn alone the next frame, the last
+    // line must be laid out again with its real glyphs, then cached.
+    std::vector<std::string> flood;
+    for (char32_t codepoint = 0xA0; codepoint < 0x530; ++codepoint) {
+        if (codepoint % 24 == 0 || flood.empty()) flood.emplace_back();
+        flood.back() += static_cast<char>(0xC0 | (codepoint >> 6));
+        flood.back() += static_cast<char>(0x80 | (codepoint & 0x3F));
+    }
+    for (size_t i = 0; i < flood.size(); ++i) text.RenderText(flood[i], 10.0f, 900.0f - 18.0f * i, 0.5f, white);
+    text.Flush(shader);
+    glyphs = text.GetGlyphStats();
+    text.RenderText(flood.back(), 10.0f, 500.0f, 0.5f, white);
+    text.Flush(shader);
+    const GlyphCacheStats redrawn = text.GetGlyphStats();
+    const unsigned int rebuilt = text.GetFrameStats().layoutsBuilt;
+    text.RenderText(flood.back(), 10.0f, 500.0f, 0.5f, white);
+    text.Flush(shader);
+    std::cout << "Flooded " << flood.size() << " lines in one frame: " << glyphs.dropped << " dropped, then "
+              << redrawn.rasterized - glyphs.rasterized << " rasterized and " << redrawn.dropped - glyphs.dropped
+              << " dropped redrawing the last line" << std::endl;
+    if (glyphs.dropped == 0 || redrawn.dropped != glyphs.dropped || redrawn.rasterized == glyphs.rasterized ||
+        rebuilt != 1 || text.GetFrameStats().layoutsBuilt != 0) {
+        std::cerr << "A line laid out with dropped glyphs was not rebuilt once pages were free" << std::endl;
+        return 1;
+    }
+
+    // The atlas, every glyph page and the stream buffer go with Destroy
+    text.Destroy();
+    frameUniforms.destroy();
+    if (GLStub::counters().liveTextures != 0 || GLStub::counters().liveBuffers != 0) {
+        std::cerr << "Destroy left " << GLStub::counters().liveTextures << " textures and "
+                  << GLStub::counters().liveBuffers << " buffers alive" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,117 @@
+// Texture usage and cost of repeated deck resets, run against a stub GL.
+// The cached path reloads the faces through TextureCache, acquiring the new
+// handles before releasing the old ones; the legacy path decodes and uploads
+// all 52 faces on every reset and never deletes the old ones, the way
+// Game::resetDeck used to. Fails if the cached path's live texture count,
+// bytes or decode count move after the first load.
+//
+// Usage: TextureCacheBench [resets] [card images dir]   (run from the build directory)
+
+#include "Card.h"
+#include "GLStub.h"
+#include "TextureCache.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <stb_image/stb_image.h>
+
+#ifndef CARD_IMAGES_DIR
+#define CARD_IMAGES_DIR "assets" // Set by CMake to the checkout's assets/
+#endif
+
+namespace {
+
+std::string facePath(const std::string& assets, int index) {
+    Card card(static_cast<Card::Rank>(index % Card::kRanks), static_cast<Card::Suit>(index / Card::kRanks));
+    return assets + "/" + card.getTextureKey() + ".png";
+}
+
+void loadDeck(TextureCache& cache, TextureCache::Handle (&faces)[Card::kDeckSize], const std::string& assets) {
+    for (int i = 0; i < Card::kDeckSize; ++i) {
+        TextureCache::Handle previous = faces[i];
+        faces[i] = cache.acquire(facePath(assets, i));
+        cache.release(previous);
+    }
+}
+
+void loadDeckUncached(const std::string& assets) {
+    for (int i = 0; i < Card::kDeckSize; ++i) {
+        int width, height, channels;
+        unsigned char* data = stbi_load(facePath(assets, i).c_str(), &width, &height, &channels, 0);
+        GLuint texture;
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        GLenum format = (channels == 4) ? GL_RGBA : GL_RGB;
+        glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
+        glGenerateMipmap(GL_TEXTURE_2D);
+        stbi_image_free(data);
+    }
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+}
+
+int main(int argc, char** argv) {
+    long long resets = argc > 1 ? std::atoll(argv[1]) : 10000;
+    std::string assets = argc > 2 ? argv[2] : CARD_IMAGES_DIR;
+    const int legacyResets = 20;
+
+    GLStub::install();
+
+    TextureCache cache;
+    TextureCache::Handle faces[Card::kDeckSize];
+    std::fill(std::begin(faces), std::end(faces), TextureCache::kInvalidHandle);
+    TextureCache::Handle back = cache.acquire(assets + "/cardBack_blue1.png");
+    TextureCache::Handle spadesA = cache.acquire(assets + "/cardSpadesA.png");
+    loadDeck(cache, faces, assets);
+    if (back == TextureCache::kInvalidHandle || cache.getLiveTextures() != Card::kDeckSize + 1) {
+        std::cerr << "Could not load the card textures from " << assets << std::endl;
+        return 1;
+    }
+
+    const int textures = cache.getLiveTextures();
+    const size_t bytes = cache.getLiveBytes();
+    const unsigned long long decodes = cache.getDecodes();
+
+    auto start = std::chrono::steady_clock::now();
+    for (long long i = 0; i < resets; ++i) loadDeck(cache, faces, assets);
+    double cachedSeconds = secondsSince(start);
+
+    bool flat = cache.getLiveTextures() == textures && cache.getLiveBytes() == bytes &&
+                cache.getDecodes() == decodes && GLStub::counters().liveTextures == textures &&
+                cache.getRefCount(spadesA) == 2;
+    std::cout << "Cached:   " << resets << " resets, " << resets / cachedSeconds << " resets/sec, "
+              << cache.getLiveTextures() << " live textures, " << cache.getLiveBytes() / 1024 << " KiB, "
+              << cache.getDecodes() << " decodes" << std::endl;
+
+    for (TextureCache::Handle face : faces) cache.release(face);
+    cache.release(spadesA);
+    cache.release(back);
+    if (cache.getLiveTextures() != 0 || cache.getLiveBytes() != 0 || GLStub::counters().liveTextures != 0) flat = false;
+
+    // A released handle stays dead once its slot holds another texture
+    TextureCache::Handle reused = cache.acquire(assets + "/cardHeartsK.png");
+    if (cache.get(back) != 0 || cache.get(spadesA) != 0 || cache.get(reused) == 0) {
+        std::cerr << "A released handle resolves to a texture acquired after it" << std::endl;
+        return 1;
+    }
+    cache.release(reused);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < legacyResets; ++i) loadDeckUncached(assets);
+    double legacySeconds = secondsSince(start);
+    std::cout << "Uncached: " << legacyResets << " resets, " << legacyResets / legacySeconds << " resets/sec, "
+              << GLStub::counters().liveTextures << " live textures" << std::endl;
+
+    if (!flat) {
+        std::cerr << "Texture usage changed across resets" << std::endl;
+        return 1;
+    }
+    return 0;
+}
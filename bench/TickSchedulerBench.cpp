@@ -0,0 +1,122 @@
+// Drives TickScheduler with synthetic clocks at several display rates,
+// steady and jittery. Each run plays the same auto-played tables one
+// action per tick for a minute of game time. Checks that every rate ends
+// in the same game state, that each tick fires in the first frame at or
+// after its due time, that the interpolation alpha stays in [0, 1) and
+// accounts for the rest of the elapsed time, and that a long stall is
+// capped instead of replayed. The old frame-locked loop is shown for
+// comparison: its dealer speed follows the refresh rate.
+//
+// Usage: TickSchedulerBench [seconds]
+
+#include "Random.h"
+#include "TableSession.h"
+#include "TableWall.h"
+#include "TickScheduler.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+const double kTickRate = TableSession::kTickRate; // Game's logic rate
+const int kTables = 16;
+
+struct Outcome {
+    unsigned long long ticks = 0;
+    unsigned long long rounds = 0;
+    unsigned long long cards = 0; // Cards left in every shoe, summed
+    bool ok = true;
+};
+
+// `jitter` stretches or shrinks each frame by up to that fraction
+Outcome play(double displayRate, double jitter, double seconds) {
+    std::vector<BlackjackEngine> tables;
+    for (int table = 0; table < kTables; ++table) tables.emplace_back(table + 1);
+    TickScheduler scheduler(kTickRate);
+    SplitMix64 rng(static_cast<std::uint64_t>(displayRate * 1000 + jitter * 10));
+    Outcome outcome;
+    double frame = 1.0 / displayRate;
+    double longest = 0.0;
+    double now = 0.0;
+    scheduler.advance(now);
+    while (scheduler.getTicks() < static_cast<unsigned long long>(seconds * kTickRate)) {
+        double delta = frame * (1.0 + jitter * ((rng() >> 11) * 0x1.0p-53 * 2.0 - 1.0));
+        longest = std::max(longest, delta);
+        now += delta;
+        int due = scheduler.advance(now);
+        for (int tick = 0; tick < due; ++tick) {
+            unsigned long long index = scheduler.getTicks() - due + tick + 1; // 1-based tick number
+            double dueAt = index * scheduler.getStep();
+            if (dueAt > now + 1e-9 || dueAt + longest < now - 1e-9) {
+                std::cerr << displayRate << " Hz: tick " << index << " due at " << dueAt << " s fired at " << now << " s"
+                          << std::endl;
+                outcome.ok = false;
+            }
+            // The same table logic the wall demo runs, one action per tick
+            if (scheduler.getTicks() - due + tick < static_cast<unsigned long long>(seconds * kTickRate)) {
+                for (BlackjackEngine& engine : tables) stepDemoTable(engine);
+            }
+        }
+        double alpha = scheduler.getAlpha();
+        double accounted = (scheduler.getTicks() + alpha) * scheduler.getStep() + scheduler.getDroppedTime();
+        if (alpha < 0.0 || alpha >= 1.0 || std::abs(accounted - now) > 1e-6) {
+            std::cerr << displayRate << " Hz: alpha " << alpha << " leaves " << now - accounted << " s unaccounted"
+                      << std::endl;
+            outcome.ok = false;
+        }
+    }
+    outcome.ticks = scheduler.getTicks();
+    for (const BlackjackEngine& engine : tables) {
+        outcome.rounds += engine.getRoundNumber();
+        outcome.cards += engine.cardsLeft();
+    }
+    return outcome;
+}
+
+}
+
+int main(int argc, char** argv) {
+    double seconds = argc > 1 ? std::atof(argv[1]) : 60.0;
+    if (seconds <= 0.0) {
+        std::cerr << "Usage: TickSchedulerBench [seconds]" << std::endl;
+        return 1;
+    }
+    bool ok = true;
+
+    const double rates[] = { 30.0, 60.0, 144.0, 240.0, 60.0, 75.0 };
+    const double jitters[] = { 0.0, 0.0, 0.0, 0.0, 0.5, 0.9 };
+    Outcome reference;
+    for (int run = 0; run < 6; ++run) {
+        Outcome outcome = play(rates[run], jitters[run], seconds);
+        std::cout << rates[run] << " Hz, jitter " << jitters[run] * 100 << "%: " << outcome.ticks << " ticks, "
+                  << outcome.rounds << " rounds, " << outcome.cards << " cards left; frame-locked dealer: "
+                  << rates[run] << " cards/sec" << std::endl;
+        if (run == 0) reference = outcome;
+        else if (outcome.rounds != reference.rounds || outcome.cards != reference.cards) {
+            std::cerr << rates[run] << " Hz ended in a different game state than " << rates[0] << " Hz" << std::endl;
+            ok = false;
+        }
+        ok = ok && outcome.ok;
+    }
+
+    // A three-second stall: at most kMaxTicksPerAdvance ticks, the rest dropped
+    TickScheduler scheduler(kTickRate);
+    scheduler.advance(0.0);
+    scheduler.advance(1.0 / 60.0);
+    int due = scheduler.advance(3.0 + 1.0 / 60.0);
+    double expectedDrop = 3.0 - TickScheduler::kMaxTicksPerAdvance * scheduler.getStep();
+    std::cout << "3 s stall: " << due << " ticks run, " << scheduler.getDroppedTime() << " s dropped" << std::endl;
+    if (due != TickScheduler::kMaxTicksPerAdvance || std::abs(scheduler.getDroppedTime() - expectedDrop) > scheduler.getStep()) {
+        std::cerr << "Stall ran " << due << " ticks and dropped " << scheduler.getDroppedTime() << " s" << std::endl;
+        ok = false;
+    }
+    // A clock that steps back runs nothing
+    if (scheduler.advance(1.0) != 0) {
+        std::cerr << "A clock stepping back produced ticks" << std::endl;
+        ok = false;
+    }
+    return ok ? 0 : 1;
+}
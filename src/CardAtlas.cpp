@@ -0,0 +1,62 @@
+#include "CardAtlas.h"
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+std::vector<std::string> buildNames() {
+    std::vector<std::string> names(CardAtlas::kSlots);
+    for (int index = 0; index < Card::kDeckSize; ++index) {
+        Card card(static_cast<Card::Rank>(index % Card::kRanks), static_cast<Card::Suit>(index / Card::kRanks));
+        names[card.getIndex()] = card.getTextureKey();
+    }
+    const char* colors[] = { "blue", "green", "red" };
+    for (int back = 0; back < CardAtlas::kBackSlots; ++back) {
+        names[CardAtlas::kFaceSlots + back] = "cardBack_" + std::string(colors[back / 5]) + std::to_string(back % 5 + 1);
+    }
+    names[CardAtlas::kJokerSlot] = "cardJoker";
+    return names;
+}
+
+}
+
+const std::string& CardAtlas::slotName(int slot) {
+    static const std::vector<std::string> names = buildNames();
+    return names[slot];
+}
+
+int CardAtlas::find(const std::string& name) {
+    for (int slot = 0; slot < kSlots; ++slot) {
+        if (slotName(slot) == name) return slot;
+    }
+    return -1;
+}
+
+bool CardAtlas::load(const std::string& tablePath) {
+    std::ifstream file(tablePath);
+    std::string magic;
+    int count = 0;
+    if (!(file >> magic >> width >> height >> count) || magic != "cardAtlas" || width <= 0 || height <= 0) {
+        std::cerr << "Failed to load card atlas table: " << tablePath << std::endl;
+        return false;
+    }
+
+    int loaded = 0;
+    std::string name;
+    int x, y, w, h;
+    for (int i = 0; i < count && file >> name >> x >> y >> w >> h; ++i) {
+        int slot = find(name);
+        if (slot < 0) continue;
+        rects[slot].u = static_cast<float>(x) / width;
+        rects[slot].v = static_cast<float>(y) / height;
+        rects[slot].width = static_cast<float>(w) / width;
+        rects[slot].height = static_cast<float>(h) / height;
+        ++loaded;
+    }
+    if (loaded != kSlots) {
+        std::cerr << "Card atlas table " << tablePath << " has " << loaded << " of " << kSlots << " slots" << std::endl;
+        return false;
+    }
+    return true;
+}
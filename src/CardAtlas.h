@@ -0,0 +1,42 @@
+#ifndef CARD_ATLAS_H
+#define CARD_ATLAS_H
+
+#include <string>
+#include "engine/Card.h"
+
+// Sub-rectangle of the atlas in texture coordinates (v = 0 is the top row)
+struct AtlasRect {
+    float u = 0.0f;
+    float v = 0.0f;
+    float width = 0.0f;
+    float height = 0.0f;
+};
+
+// Slot table for assets/cardAtlas.png, the card atlas baked by
+// tools/AtlasBaker. Slots 0-51 are the faces in Card::getIndex() order,
+// then the 15 cardBack_* variants, then the joker. The baker writes where
+// each slot landed to cardAtlas.txt, which load() reads back.
+class CardAtlas {
+public:
+    static const int kFaceSlots = Card::kDeckSize;
+    static const int kBackSlots = 15;
+    static const int kJokerSlot = kFaceSlots + kBackSlots;
+    static const int kSlots = kJokerSlot + 1;
+
+    static const std::string& slotName(int slot); // Asset name, e.g. "cardSpadesA", "cardBack_blue1"
+    static int find(const std::string& name);      // Slot for an asset name, -1 if none
+
+    bool load(const std::string& tablePath);
+
+    const AtlasRect& getRect(int slot) const { return rects[slot]; }
+    const AtlasRect& getRect(Card card) const { return rects[card.getIndex()]; }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+
+private:
+    AtlasRect rects[kSlots];
+    int width = 0;
+    int height = 0;
+};
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef FONT_ATLAS_FORMAT_H
+#define FONT_ATLAS_FORMAT_H
+
+#include <cstdint>
+
+// On-disk layout of assets/fontAtlas.bin, written by tools/FontBaker and
+// memory-mapped by TextRenderer. The file is a Header, then glyphCount
+// Glyphs, then kerningCount Kerning pairs, then atlasWidth * atlasHeight
+// bytes of signed distance field. Every record is a multiple of 4 bytes,
+// so all of them are aligned in a mapped file. Little-endian.
+namespace FontAtlasFormat {
+
+const char kMagic[4] = { 'B', 'J', 'F', 'A' };
+const std::uint32_t kVersion = 1;
+
+struct Header {
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t pixelHeight;  // Size the distance fields were built at
+    std::uint32_t padding;      // Pixels of distance around each glyph
+    std::uint32_t onEdge;       // Texel value on the outline
+    std::uint32_t atlasWidth;
+    std::uint32_t atlasHeight;
+    std::uint32_t glyphCount;
+    std::uint32_t kerningCount;
+};
+
+// Metrics are in pixels at pixelHeight
+struct Glyph {
+    std::uint32_t codepoint;
+    std::uint16_t x, y;          // Top-left in the atlas
+    std::uint16_t width, height;
+    std::int16_t bearingX;       // Pen to left edge
+    std::int16_t bearingY;       // Baseline to top edge, up is positive
+    float advance;
+};
+
+struct Kerning {
+    std::uint32_t first;
+    std::uint32_t second;
+    float adjust;                // Added to the first glyph's advance
+};
+
+static_assert(sizeof(Header) == 36, "Header must have no padding");
+static_assert(sizeof(Glyph) == 20, "Glyph must have no padding");
+static_assert(sizeof(Kerning) == 12, "Kerning must have no padding");
+
+}
+
+#endif
@@ -0,0 +1,44 @@
+#include "FrameChannel.h"
+
+void FrameChannel::publish() {
+    buffer.back().sequence = ++sequence;
+    buffer.publish();
+    published.store(sequence, std::memory_order_relaxed);
+    // Both sides use sequentially consistent accesses on `sleeping` and the
+    // buffer, so either this sees the renderer asleep or it sees the snapshot
+    if (sleeping.load()) {
+        std::lock_guard<std::mutex> lock(mutex);
+        wake.notify_one();
+    }
+}
+
+void FrameChannel::close() {
+    closed = true;
+    std::lock_guard<std::mutex> lock(mutex);
+    wake.notify_one();
+}
+
+const FrameSnapshot* FrameChannel::waitLatest() {
+    if (!buffer.acquire()) {
+        std::unique_lock<std::mutex> lock(mutex);
+        sleeping = true;
+        wake.wait(lock, [this] { return buffer.hasFresh() || closed; });
+        sleeping = false;
+        if (!buffer.acquire()) return nullptr; // Closed
+    }
+    if (closed) return nullptr;
+
+    const FrameSnapshot& snapshot = buffer.front();
+    dropped.fetch_add(snapshot.sequence - lastTaken - 1, std::memory_order_relaxed);
+    rendered.fetch_add(1, std::memory_order_relaxed);
+    lastTaken = snapshot.sequence;
+    return &snapshot;
+}
+
+FrameChannel::Counters FrameChannel::getCounters() const {
+    Counters counters;
+    counters.published = published.load(std::memory_order_relaxed);
+    counters.rendered = rendered.load(std::memory_order_relaxed);
+    counters.dropped = dropped.load(std::memory_order_relaxed);
+    return counters;
+}
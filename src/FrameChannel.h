@@ -0,0 +1,48 @@
+#ifndef FRAME_CHANNEL_H
+#define FRAME_CHANNEL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include "FrameSnapshot.h"
+#include "TripleBuffer.h"
+
+// Carries FrameSnapshots from the logic thread to the render thread
+// through a TripleBuffer. Publishing never blocks on rendering; a renderer
+// that falls behind skips to the newest snapshot, and the ones it missed
+// count as dropped. When no snapshot is waiting the render thread sleeps,
+// and the logic thread only takes the lock to wake it when it is asleep.
+class FrameChannel {
+public:
+    struct Counters {
+        unsigned long long published = 0; // Snapshots the logic thread sent
+        unsigned long long rendered = 0;  // Snapshots the render thread took
+        unsigned long long dropped = 0;   // Overwritten before the render thread got to them
+    };
+
+    // Logic thread: fill snapshot(), then publish() it
+    FrameSnapshot& snapshot() { return buffer.back(); }
+    void publish();
+    void close(); // Wakes the render thread for good
+
+    // Render thread: the newest snapshot not yet taken, sleeping until one
+    // arrives. nullptr once the channel is closed.
+    const FrameSnapshot* waitLatest();
+
+    Counters getCounters() const; // Either thread
+
+private:
+    TripleBuffer<FrameSnapshot> buffer;
+    unsigned long long sequence = 0;  // Logic thread
+    unsigned long long lastTaken = 0; // Render thread
+    std::atomic<unsigned long long> published{ 0 };
+    std::atomic<unsigned long long> rendered{ 0 };
+    std::atomic<unsigned long long> dropped{ 0 };
+
+    std::atomic<bool> closed{ false };
+    std::atomic<bool> sleeping{ false };
+    std::mutex mutex;
+    std::condition_variable wake;
+};
+
+#endif
@@ -0,0 +1,16 @@
+#include "FramePacer.h"
+
+double FramePacer::waitTimeout() const {
+    if (dirty) return 0.0; // Changed outside the loop body, e.g. before the first frame
+    return animating ? kFrameInterval : kIdleTimeout;
+}
+
+bool FramePacer::beginFrame() {
+    if (!dirty) {
+        ++counters.skipped;
+        return false;
+    }
+    dirty = false;
+    ++counters.rendered;
+    return true;
+}
@@ -0,0 +1,41 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+// Decides when the main loop renders and how long it sleeps in between.
+// The loop waits for window events for waitTimeout() seconds, applies
+// whatever happened, and presents a frame only if something marked the
+// scene dirty. While an animation runs the wait is one frame interval, so
+// it keeps ticking; otherwise the loop sleeps until input arrives or the
+// idle timeout passes, and an idle game renders nothing at all.
+//
+// No GLFW here, so the pacing can be checked headless.
+class FramePacer {
+public:
+    static constexpr double kFrameInterval = 1.0 / 60.0; // Wait while animating, seconds
+    static constexpr double kIdleTimeout = 0.5;          // Wait when nothing is animating
+
+    struct Counters {
+        unsigned long long rendered = 0; // Frames presented
+        unsigned long long skipped = 0;  // Wakeups with nothing to draw
+    };
+
+    void markDirty() { dirty = true; }
+    void setAnimating(bool animating) { this->animating = animating; }
+    bool isAnimating() const { return animating; }
+
+    double waitTimeout() const;
+
+    // Call once per wakeup, after input and updates. True if this wakeup
+    // must render; clears the dirty flag.
+    bool beginFrame();
+
+    const Counters& getCounters() const { return counters; }
+    void resetCounters() { counters = Counters(); }
+
+private:
+    bool dirty = true; // The first frame always renders
+    bool animating = false;
+    Counters counters;
+};
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef FRAME_SNAPSHOT_H
+#define FRAME_SNAPSHOT_H
+
+#include <type_traits>
+#include "engine/Hand.h"
+
+// Everything the renderer needs to draw one frame of the table, copied out
+// of the game state by the logic thread. Fixed size and trivially
+// copyable, so publishing one never allocates or shares anything with the
+// game that keeps changing.
+struct FrameSnapshot {
+    enum Button { Hit, Stand, Restart, kButtons };
+    static const int kMessageSize = 32;
+
+    unsigned long long sequence = 0; // Publish order, 1 for the first
+    Hand player;
+    Hand dealer;
+    bool holeCardHidden = true;
+    float dealerSlide = 1.0f;        // How far the dealer's newest card is from the shoe to its place
+    int playerScore = 0;
+    int dealerScore = 0;             // Only the up-card while the hole card is hidden
+    char message[kMessageSize] = {}; // Round result, empty during play
+    bool buttonEnabled[kButtons] = {};
+};
+
+static_assert(std::is_trivially_copyable<FrameSnapshot>::value, "FrameSnapshot is copied between threads as is");
+
+#endif
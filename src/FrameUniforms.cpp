@@ -0,0 +1,28 @@
+#include "FrameUniforms.h"
+#include <cstring>
+
+void FrameUniforms::create() {
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(FrameData), nullptr, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    glBindBufferBase(GL_UNIFORM_BUFFER, kBinding, buffer);
+    valid = false;
+}
+
+void FrameUniforms::destroy() {
+    if (buffer) glDeleteBuffers(1, &buffer);
+    buffer = 0;
+    valid = false;
+}
+
+bool FrameUniforms::update(const FrameData& data) {
+    if (!buffer || (valid && std::memcmp(&current, &data, sizeof(FrameData)) == 0)) return false;
+    glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(FrameData), &data);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    current = data;
+    valid = true;
+    ++uploads;
+    return true;
+}
@@ -0,0 +1,41 @@
+#ifndef FRAME_UNIFORMS_H
+#define FRAME_UNIFORMS_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+// Values every program reads, laid out as the std140 block
+//
+//     layout(std140) uniform FrameData { mat4 projection; };
+//
+// Under std140 a mat4 is four vec4 columns; pad any vec3 added here to a vec4.
+struct FrameData {
+    glm::mat4 projection;
+};
+
+static_assert(sizeof(FrameData) == 64, "FrameData must match its std140 layout");
+
+// The uniform buffer behind FrameData, bound at kBinding. Programs point
+// their FrameData block there with Shader::bindUniformBlock. Call create()
+// and destroy() with the GL context current.
+class FrameUniforms {
+public:
+    static const GLuint kBinding = 0;
+    static constexpr const char* kBlockName = "FrameData";
+
+    void create();
+    void destroy();
+
+    // Sends `data` unless it matches what the buffer already holds
+    bool update(const FrameData& data);
+
+    unsigned long long getUploads() const { return uploads; }
+
+private:
+    GLuint buffer = 0;
+    FrameData current;
+    bool valid = false;       // `current` is what the buffer holds
+    unsigned long long uploads = 0;
+};
+
+#endif
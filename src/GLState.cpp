@@ -0,0 +1,103 @@
+#include "GLState.h"
+
+GLState& GLState::current() {
+    static GLState state;
+    return state;
+}
+
+void GLState::useProgram(GLuint name) {
+    if (program == name) {
+        ++counters.elided;
+        return;
+    }
+    glUseProgram(name);
+    program = name;
+    ++counters.issued;
+}
+
+void GLState::bindTexture(GLuint texture, int unit) {
+    if (textures[unit] == texture) {
+        ++counters.elided;
+        return;
+    }
+    if (activeUnit != unit) {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        activeUnit = unit;
+        ++counters.issued;
+    }
+    glBindTexture(GL_TEXTURE_2D, texture);
+    textures[unit] = texture;
+    ++counters.issued;
+}
+
+void GLState::bindVertexArray(GLuint name) {
+    if (vertexArray == name) {
+        ++counters.elided;
+        return;
+    }
+    glBindVertexArray(name);
+    vertexArray = name;
+    ++counters.issued;
+}
+
+void GLState::bindArrayBuffer(GLuint buffer) {
+    if (arrayBuffer == buffer) {
+        ++counters.elided;
+        return;
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    arrayBuffer = buffer;
+    ++counters.issued;
+}
+
+void GLState::setBlend(bool enabled) {
+    setCapability(GL_BLEND, blend, enabled);
+}
+
+void GLState::setBlendFunc(GLenum source, GLenum destination) {
+    if (blendSource == source && blendDestination == destination) {
+        ++counters.elided;
+        return;
+    }
+    glBlendFunc(source, destination);
+    blendSource = source;
+    blendDestination = destination;
+    ++counters.issued;
+}
+
+void GLState::setDepthTest(bool enabled) {
+    setCapability(GL_DEPTH_TEST, depthTest, enabled);
+}
+
+void GLState::setCapability(GLenum capability, int& state, bool enabled) {
+    if (state == static_cast<int>(enabled)) {
+        ++counters.elided;
+        return;
+    }
+    if (enabled) glEnable(capability);
+    else glDisable(capability);
+    state = enabled;
+    ++counters.issued;
+}
+
+void GLState::textureDeleted(GLuint texture) {
+    for (GLuint& bound : textures) {
+        if (bound == texture) bound = 0;
+    }
+}
+
+void GLState::bufferDeleted(GLuint buffer) {
+    if (arrayBuffer == buffer) arrayBuffer = 0;
+}
+
+void GLState::invalidate() {
+    program = kUnknown;
+    for (GLuint& bound : textures) bound = kUnknown;
+    activeUnit = -1;
+    vertexArray = kUnknown;
+    arrayBuffer = kUnknown;
+    blend = -1;
+    depthTest = -1;
+    blendSource = kUnknown;
+    blendDestination = kUnknown;
+}
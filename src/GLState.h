@@ -0,0 +1,63 @@
+#ifndef GL_STATE_H
+#define GL_STATE_H
+
+#include <glad/glad.h>
+
+// Shadow copy of the GL state the game changes between draws: program,
+// 2D texture per unit, vertex array, array buffer, blending and depth test.
+// Each setter issues the GL call only when the value differs from the last
+// one set, and counts issued and elided calls. Everything starts unknown,
+// so the first request of each kind always reaches GL.
+//
+// The game has one GL context, so there is one tracker, current(). Code
+// that changes tracked state must go through it; after anything else
+// touches GL behind its back, call invalidate().
+class GLState {
+public:
+    static const int kTextureUnits = 8;
+
+    struct Counters {
+        unsigned long long issued = 0; // GL calls made
+        unsigned long long elided = 0; // Requests that matched the current state
+    };
+
+    static GLState& current();
+
+    void useProgram(GLuint program);
+    void bindTexture(GLuint texture, int unit = 0);  // GL_TEXTURE_2D on GL_TEXTURE0 + unit
+    void bindVertexArray(GLuint vertexArray);
+    void bindArrayBuffer(GLuint buffer);
+    void setBlend(bool enabled);
+    void setBlendFunc(GLenum source, GLenum destination);
+    void setDepthTest(bool enabled);
+
+    // GL unbinds deleted objects; call these so a recycled name is not
+    // mistaken for the one still bound
+    void textureDeleted(GLuint texture);
+    void bufferDeleted(GLuint buffer);
+
+    void invalidate();
+
+    const Counters& getCounters() const { return counters; }
+    void resetCounters() { counters = Counters(); }
+
+private:
+    static const GLuint kUnknown = 0xFFFFFFFFu;
+
+    void setCapability(GLenum capability, int& state, bool enabled);
+
+    GLuint program = kUnknown;
+    GLuint textures[kTextureUnits];
+    int activeUnit = -1;
+    GLuint vertexArray = kUnknown;
+    GLuint arrayBuffer = kUnknown;
+    int blend = -1;             // -1 unknown, else 0 or 1
+    int depthTest = -1;
+    GLenum blendSource = kUnknown;
+    GLenum blendDestination = kUnknown;
+    Counters counters;
+
+    GLState() { invalidate(); }
+};
+
+#endif
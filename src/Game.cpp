@@ -1,37 +1,44 @@
 #include "Game.h"
 #include <iostream>
 #include <algorithm>
-#define STB_IMAGE_IMPLEMENTATION
-#include <stb_image/stb_image.h>
+#include <chrono>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include "GLState.h"
 #include "TextRenderer.h"
 
 const std::string Game::TextvertexShaderSource = R"(
 #version 330 core
 layout (location = 0) in vec4 vertex; // (position, texcoords)
+layout (location = 1) in vec3 vertexColor;
 out vec2 TexCoords;
+out vec3 TextColor;
 
-uniform mat4 projection;
+layout (std140) uniform FrameData { // See FrameUniforms.h
+    mat4 projection;
+};
 
 void main() {
     gl_Position = projection * vec4(vertex.xy, 0.0, 1.0);
     TexCoords = vertex.zw;
+    TextColor = vertexColor;
 }
 )";
 
 const std::string Game::TextfragmentShaderSource = R"(
 #version 330 core
 in vec2 TexCoords;
+in vec3 TextColor;
 out vec4 color;
 
-uniform sampler2D text;
-uniform vec3 textColor;
+uniform sampler2D text; // Signed distance field, 0.5 on the outline
 
 void main() {    
-    float alpha = texture(text, TexCoords).r;
-    color = vec4(textColor, alpha);
+    float distance = texture(text, TexCoords).r;
+    float smoothing = fwidth(distance); // About one screen pixel at any scale
+    float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);
+    color = vec4(TextColor, alpha);
 }
 )";
 
@@ -39,16 +46,17 @@ void main() {
 // Initialize static members
 const std::string Game::vertexShaderSource = R"(
     #version 330 core
-    layout (location = 0) in vec3 aPos;
+    layout (location = 0) in vec2 aPos; // Already transformed, see SpriteBatch
     layout (location = 1) in vec2 aTexCoord;
+    layout (location = 2) in vec4 aTint;
 
     out vec2 TexCoord;
-
-    uniform mat4 model;
+    out vec4 Tint;
 
     void main() {
-        gl_Position = model * vec4(vec3(aPos.x, -aPos.y, aPos.z), 1.0);
+        gl_Position = vec4(aPos, 0.0, 1.0);
         TexCoord = aTexCoord;
+        Tint = aTint;
     }
 )";
 
@@ -57,10 +65,11 @@ const std::string Game::fragmentShaderSource = R"(
     out vec4 FragColor;
 
     in vec2 TexCoord;
+    in vec4 Tint;
     uniform sampler2D texture1;
 
     void main() {
-        FragColor = texture(texture1, TexCoord);
+        FragColor = texture(texture1, TexCoord) * Tint;
     }
 )";
 
@@ -82,230 +91,95 @@ std::vector<Button> buttons = {
 TextRenderer* textRenderer;
 std::string gameMessage;
 
-Game::Game() : gameState(1), playerTurn(true), rng(std::random_device{}()), deckEmpty(false) {}
+// Card back shown for the dealer's hole card and behind the buttons
+const int kCardBackSlot = CardAtlas::find("cardBack_blue1");
+// Where dealt cards slide in from
+const glm::vec2 kShoePosition(0.85f, 0.55f);
 
-GLuint Game::loadTexture(const char* path) {
-    GLuint texture;
-    glGenTextures(1, &texture);
-    glBindTexture(GL_TEXTURE_2D, texture);
+// Wall tables act every this many ticks, staggered so a few move each tick
+static const int kWallStepTicks = 8;
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+Game::Game(int wallTables)
+    : renderSeconds(0.0), atlasTexture(TextureCache::kInvalidHandle), announcedRound(0), shownPlayerScore(-1),
+      shownDealerScore(-1), wallTables(wallTables), wallTick(0) {}
 
-    int width, height, nrChannels;
-    unsigned char* data = stbi_load(path, &width, &height, &nrChannels, 0);
-    if (data) {
-        GLenum format = (nrChannels == 4) ? GL_RGBA : GL_RGB;
-        glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-        glGenerateMipmap(GL_TEXTURE_2D);
-    }
-    else {
-        std::cerr << "Failed to load texture: " << path << std::endl;
-    }
-    stbi_image_free(data);
-    return texture;
+TextureCache::Handle Game::loadTexture(const char* path) {
+    return textureCache.acquire(path);
 }
 
 void Game::initializeCardRendering() {
-    float vertices[] = {
-        -0.5f,  0.5f, 0.0f,  0.0f, 1.0f,
-         0.5f,  0.5f, 0.0f,  1.0f, 1.0f,
-         0.5f, -0.5f, 0.0f,  1.0f, 0.0f,
-        -0.5f, -0.5f, 0.0f,  0.0f, 0.0f
-    };
-
-    unsigned int indices[] = { 0, 1, 2, 2, 3, 0 };
-
-    glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-    glGenBuffers(1, &EBO);
-
-    glBindVertexArray(VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-
-    glBindVertexArray(0);
-}
-
-void Game::resetDeck() {
-    deck.clear();
-    initializeDeck();
-    shuffleDeck();
-    deckEmpty = false;
-    resetGame();
+    spriteBatch.create();
 }
 
 void Game::loadAssets() {
-    textures["cardBack"] = loadTexture("assets/cardBack_blue1.png");
-    textures["cardSpadesA"] = loadTexture("assets/cardSpadesA.png");
-    textRenderer = new TextRenderer("assets/font.ttf", 24);
-
-    // Enable blending for text rendering
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    textRenderer = new TextRenderer("assets/fontAtlas.bin", 24, "assets/font.ttf");
 }
 
 void Game::initializeDeck() {
-    std::vector<std::string> suits = { "Spades", "Hearts", "Clubs", "Diamonds" };
-    std::vector<std::string> ranks = { "2", "3", "4", "5", "6", "7", "8", "9", "10", "J", "Q", "K", "A" };
-    std::vector<int> values = { 2, 3, 4, 5, 6, 7, 8, 9, 10, 10, 10, 10, 11 };
-
-    for (const auto& suit : suits) {
-        for (size_t i = 0; i < ranks.size(); ++i) {
-            std::string cardName = ranks[i] + " of " + suit;
-            GLuint texture = loadTexture(("assets/card" + suit + ranks[i] + ".png").c_str());
-            deck.emplace_back(cardName, values[i], texture);
-        }
-    }
+    // One texture holds every card; acquiring before releasing the previous
+    // handle means calling this again never re-decodes the atlas.
+    TextureCache::Handle previous = atlasTexture;
+    atlasTexture = loadTexture("assets/cardAtlas.png");
+    textureCache.release(previous);
+    atlas.load("assets/cardAtlas.txt");
 }
 
-void Game::shuffleDeck() {
-    std::shuffle(deck.begin(), deck.end(), rng);
-}
-
-void Game::dealInitialCards() {
-    if (deck.size() < 4) {
-        std::cout << "Not enough cards for a new round. Resetting deck..." << std::endl;
-        resetDeck();
-        return;
-    }
-    playerHand.clear();
-    dealerHand.clear();
-    dealCard(playerHand);
-    dealCard(dealerHand);
-    dealCard(playerHand);
-    dealCard(dealerHand);
-}
-
-
 void Game::resetGame() {
-    if (deck.size() < 4) {
-        std::cout << "Not enough cards to start a new game. Resetting deck..." << std::endl;
-        resetDeck();
-        return;
+    if (session.getEngine().getShoe().needsShuffle()) {
+        std::cout << "Cut card reached. Reshuffling the shoe..." << std::endl;
     }
-    gameState = 1;
-    gameMessage.clear();
-    playerTurn = true;
-    playerHand.clear();
-    dealerHand.clear();
-    dealInitialCards();
+    session.newRound();
     std::cout << "Game reset. New round starting!" << std::endl;
-    std::cout << "Cards left in deck: " << deck.size() << std::endl;
+    std::cout << "Cards left in deck: " << session.getEngine().cardsLeft() << std::endl;
 }
 
+void Game::press(TableSession::Action action) {
+    const BlackjackEngine& engine = session.getEngine();
+    bool dealing = engine.getState() == RoundState::Finished;
+    bool cutCardOut = engine.getShoe().needsShuffle();
+    if (!session.press(action)) return;
 
-
-void Game::dealCard(std::vector<Card>& hand) {
-    if (deck.empty()) {
-        std::cout << "Deck is finished. Restarting the game automatically..." << std::endl;
-        resetDeck(); // Automatically reset the deck and restart the game
+    if (dealing) {
+        if (cutCardOut) std::cout << "Cut card reached. Reshuffling the shoe..." << std::endl;
+        std::cout << "Game reset. New round starting!" << std::endl;
+        std::cout << "Cards left in deck: " << engine.cardsLeft() << std::endl;
         return;
     }
-    hand.push_back(deck.back());
-    deck.pop_back();
-    std::cout << "Cards left in deck: " << deck.size() << std::endl;
+    if (action != TableSession::Action::Hit) return;
 
-    if (deck.size() < 4) {
-        std::cout << "Warning: Deck is running low. Not enough cards for the next round!" << std::endl;
-    }
-}
-
-
-
-int Game::calculateScore(const std::vector<Card>& hand) {
-    int score = 0;
-    int aceCount = 0;
-
-    for (const auto& card : hand) {
-        score += card.getValue();
-        if (card.getValue() == 11) ++aceCount;
+    std::cout << "Cards left in deck: " << engine.cardsLeft() << std::endl;
+    if (engine.getState() == RoundState::Finished) {
+        int playerScore = engine.getPlayerHand().getScore();
+        if (playerScore == 21) {
+            std::cout << "Player hits 21! You win!" << std::endl;
+        }
+        else if (playerScore > 21) {
+            std::cout << "Player busts!" << std::endl;
+        }
     }
-
-    while (score > 21 && aceCount > 0) {
-        score -= 10;
-        --aceCount;
+    if (engine.cardsLeft() < 4) {
+        std::cout << "Warning: Deck is running low. Not enough cards for the next round!" << std::endl;
     }
-
-    return score;
 }
 
 void Game::handleInput(GLFWwindow* window) {
+    // One press per stroke, however many loop passes the key is held for;
+    // TableSession decides what the press does in the current state
     static bool hitPressed = false;
     static bool standPressed = false;
     static bool restartPressed = false;
 
-    if (gameState == 2) {
-        // Allow "Hit" button to restart the game when the round ends
-        if (glfwGetKey(window, GLFW_KEY_H) == GLFW_PRESS) {
-            if (!hitPressed) {
-                hitPressed = true;
-                resetGame();
-                std::cout << "New round started via Hit button!" << std::endl;
-            }
-        }
-        else {
-            hitPressed = false;
-        }
+    bool hitDown = glfwGetKey(window, GLFW_KEY_H) == GLFW_PRESS;
+    if (hitDown && !hitPressed) press(TableSession::Action::Hit);
+    hitPressed = hitDown;
 
-        // Disable "R" button functionality during the game
-        return;
-    }
+    bool standDown = glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS;
+    if (standDown && !standPressed) press(TableSession::Action::Stand);
+    standPressed = standDown;
 
-    if (gameState == 1) {
-        // Handle "Hit" input during gameplay
-        if (glfwGetKey(window, GLFW_KEY_H) == GLFW_PRESS) {
-            if (!hitPressed) {
-                hitPressed = true;
-                dealCard(playerHand);
-                int playerScore = calculateScore(playerHand);
-                if (playerScore == 21) {
-                    std::cout << "Player hits 21! You win!" << std::endl;
-                    gameState = 2; // End the game
-                }
-                else if (playerScore > 21) {
-                    std::cout << "Player busts!" << std::endl;
-                    gameState = 2; // End the game
-                }
-            }
-        }
-        else {
-            hitPressed = false;
-        }
-
-        // Handle "Stand" input
-        if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS) {
-            if (!standPressed) {
-                standPressed = true;
-                playerTurn = false; // End the player's turn
-            }
-        }
-        else {
-            standPressed = false;
-        }
-    }
-
-    // Handle "Restart" input (only when game is not in progress)
-    if (glfwGetKey(window, GLFW_KEY_R) == GLFW_PRESS && gameState != 1) {
-        if (!restartPressed) {
-            restartPressed = true;
-            resetGame();
-            std::cout << "Game restarted via Restart button!" << std::endl;
-        }
-    }
-    else {
-        restartPressed = false;
-    }
+    bool restartDown = glfwGetKey(window, GLFW_KEY_R) == GLFW_PRESS;
+    if (restartDown && !restartPressed) press(TableSession::Action::Restart);
+    restartPressed = restartDown;
 }
 
 
@@ -319,35 +193,9 @@ void Game::handleMouseClick(float mouseX, float mouseY) {
 
         if (mouseX >= buttonLeft && mouseX <= buttonRight &&
             mouseY >= buttonBottom && mouseY <= buttonTop) {
-            if (button.action == "hit") {
-                if (gameState == 2) {
-                    // If the game has ended, start a new round
-                    resetGame();
-                    std::cout << "New round started via Hit button!" << std::endl;
-                }
-                else if (gameState == 1 && playerTurn) {
-                    // Normal Hit functionality during gameplay
-                    dealCard(playerHand);
-                    int playerScore = calculateScore(playerHand);
-                    if (playerScore == 21) {
-                        std::cout << "Player hits 21! You win!" << std::endl;
-                        gameState = 2; // End the game
-                    }
-                    else if (playerScore > 21) {
-                        std::cout << "Player busts!" << std::endl;
-                        gameState = 2; // End the game
-                    }
-                }
-            }
-            else if (button.action == "stand" && gameState == 1 && playerTurn) {
-                // Stand functionality during gameplay
-                playerTurn = false;
-            }
-            else if (button.action == "restart" && gameState != 1) {
-                // Restart functionality only when the game is not in progress
-                resetGame();
-                std::cout << "Game restarted via Restart button!" << std::endl;
-            }
+            if (button.action == "hit") press(TableSession::Action::Hit);
+            else if (button.action == "stand") press(TableSession::Action::Stand);
+            else if (button.action == "restart") press(TableSession::Action::Restart);
         }
     }
 }
@@ -371,167 +219,270 @@ void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
 }
 
 
-void Game::update() {
+void windowRefreshCallback(GLFWwindow* window) {
+    static_cast<Game*>(glfwGetWindowUserPointer(window))->requestRedraw();
+}
 
-    glDisable(GL_DEPTH_TEST); // Ensure text appears on top
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-     int dealerScore = calculateScore(dealerHand);
-     int playerScore = calculateScore(playerHand);
 
-    if (!playerTurn && gameState == 1) {
-        if (dealerScore < 17) {
-            dealCard(dealerHand);
-        }
-        else {
-            std::cout << "Player Score: " << playerScore << ", Dealer Score: " << dealerScore << std::endl;
-            gameState = 2; // End the game
-        }
+void Game::update() {
+    const BlackjackEngine& engine = session.getEngine();
+    if (engine.getState() != RoundState::Finished) {
+        gameMessage.clear();
     }
-    else if (gameState == 2) {
-        if ((playerScore > dealerScore  && playerScore < 22)|| dealerScore > 21) {
-            std::cout << "Player wins with " << playerScore << " points!" << std::endl;
+    else if (announcedRound != engine.getRoundNumber()) {
+        announcedRound = engine.getRoundNumber();
+        switch (engine.getResult()) {
+        case RoundResult::PlayerWins:
+            std::cout << "Player wins with " << engine.getPlayerHand().getScore() << " points!" << std::endl;
             gameMessage = "PLAYER WINS!";
-
-        }
-        else if (playerScore == dealerScore) {
+            break;
+        case RoundResult::Tie:
             std::cout << "It's a tie!" << std::endl;
             gameMessage = "IT'S A TIE!";
-        }
-        else if ((playerScore < dealerScore && dealerScore < 22) || playerScore > 21) {
-            std::cout << "Dealer wins with " << dealerScore << " points!" << std::endl;
+            break;
+        case RoundResult::DealerWins:
+            std::cout << "Dealer wins with " << engine.getDealerHand().getScore() << " points!" << std::endl;
             gameMessage = "DEALER WINS!";
-        }
-        else if (playerScore > 21) {
-            std::cout << "BUST!" << std::endl;
-            gameMessage = "PLAYER BUSTED!";
-        }
-        else if (dealerScore > 21) {
-            std::cout << "BUST!" << std::endl;
-            gameMessage = "DEALER BUSTED!";
+            break;
+        default:
+            break;
         }
     }
 
-    glDisable(GL_BLEND);
-
-    // Auto-restart when deck is empty and game ends
-    if (deck.empty() && gameState == 2) {
+    // Auto-restart when deck is empty and game ends; also keeps the pacer
+    // animating while the dealer plays
+    if (session.update()) {
         std::cout << "Deck is empty. Restarting the game automatically..." << std::endl;
-        resetDeck();
+        std::cout << "Deck reset. Cards left in deck: " << engine.cardsLeft() << std::endl;
     }
 }
 
-void Game::renderCards(const std::vector<Card>& hand, float startX, float startY, bool hideSecondCard) {
-    shader->use();
-    glActiveTexture(GL_TEXTURE0);
-    glUniform1i(glGetUniformLocation(shader->getID(), "texture1"), 0);
-
-    glBindVertexArray(VAO);
-    for (size_t i = 0; i < hand.size(); ++i) {
-        if (hideSecondCard && i == 1) {
-            glBindTexture(GL_TEXTURE_2D, textures["cardBack"]);
-        }
-        else {
-            glBindTexture(GL_TEXTURE_2D, hand[i].getTextureID());
-        }
-
-        glm::mat4 model = glm::mat4(1.0f);
-        model = glm::translate(model, glm::vec3(startX + i * 0.2f *1.3, startY, 0.0f));
-        model = glm::scale(model, glm::vec3(0.18f * 1.2, 0.28f * 1.2, 1.0f));
-
-        glUniformMatrix4fv(glGetUniformLocation(shader->getID(), "model"), 1, GL_FALSE, glm::value_ptr(model));
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+void Game::tickWall() {
+    for (int table = 0; table < wallTables; ++table) {
+        if ((wallTick + table) % kWallStepTicks == 0) stepDemoTable(wallEngines[table]);
     }
-    glBindVertexArray(0);
+    ++wallTick;
 }
 
-void Game::renderButton(float x, float y, const std::string& textureKey, const std::string& label) {
-    // Render button background
-    shader->use();
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, textures[textureKey]);
+bool Game::updateWall() {
+    bool changed = false;
+    for (int table = 0; table < wallTables; ++table) {
+        changed |= wall.update(table, wallEngines[table]); // Rewrites only tables that changed
+    }
+    return changed;
+}
 
-    glm::mat4 model = glm::mat4(1.0f);
-    model = glm::translate(model, glm::vec3(x, y, 0.0f));
-    model = glm::scale(model, glm::vec3(0.4f, 0.2f, 1.0f)); // Button size
+void Game::renderWall() {
+    glClearColor(0.2f, 0.5f, 0.2f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    glUniformMatrix4fv(glGetUniformLocation(shader->getID(), "model"), 1, GL_FALSE, glm::value_ptr(model));
-    glUniform1i(glGetUniformLocation(shader->getID(), "texture1"), 0);
+    // Cards on the wall never overlap, so neither depth nor blending is needed
+    GLState::current().setDepthTest(false);
+    GLState::current().setBlend(false);
+    wallRenderer.upload(wall);
+    wallRenderer.draw(wall, textureCache.get(atlasTexture));
+}
 
-    glBindVertexArray(VAO);
-    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-    glBindVertexArray(0);
+void Game::renderCards(const Hand& hand, float startX, float startY, bool hideSecondCard, float lastCardSlide) {
+    shader->use();
+    // Queued; render() draws every card and button together
+    GLuint texture = textureCache.get(atlasTexture);
+    for (int i = 0; i < hand.size(); ++i) {
+        const AtlasRect& rect = (hideSecondCard && i == 1) ? atlas.getRect(kCardBackSlot) : atlas.getRect(hand[i]);
+        glm::vec2 position(startX + i * 0.2f * 1.3f, startY);
+        // A card still sliding in from the shoe passes over the other hand, so it goes in a layer above
+        int layer = 0;
+        if (i == hand.size() - 1 && lastCardSlide < 1.0f) {
+            position = glm::mix(kShoePosition, position, lastCardSlide);
+            layer = 1;
+        }
+        spriteBatch.draw(*shader, texture, position, glm::vec2(0.18f * 1.2f, 0.28f * 1.2f), rect, glm::vec4(1.0f),
+                         layer);
+    }
+}
 
-    // Render button label
-    glDisable(GL_DEPTH_TEST); // Ensure text appears on top
-    
-    textShader->use();
+void Game::renderButton(float x, float y, int atlasSlot, std::string_view label, bool enabled) {
+    // Queue button background, dimmed while the button does nothing; render() draws it with the cards
+    glm::vec4 tint = enabled ? glm::vec4(1.0f) : glm::vec4(0.55f, 0.55f, 0.55f, 1.0f);
+    spriteBatch.draw(*shader, textureCache.get(atlasTexture), glm::vec2(x, y), glm::vec2(0.4f, 0.2f), // Button size
+                     atlas.getRect(atlasSlot), tint);
 
+    // Queue button label; render() draws it with the rest of the text
     // Adjust text scale and alignment
     float textScale = 0.8f; // Adjust for button size
-    float textWidth = label.size() * 12.0f * textScale; // Estimate text width
+    float textWidth = textRenderer->MeasureText(label, textScale);
     float textHeight = 24.0f * textScale;              // Estimate text height
     float textX = (x + 1.0f) * (1280.0f / 2.0f) - textWidth / 2.0f; // Center horizontally
     float textY = (y + 1.0f) * (960.0f / 2.0f) - textHeight / 2.0f; // Center vertically
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    textRenderer->RenderText(*textShader, label, textX, textY, textScale, glm::vec3(1.0f, 1.0f, 1.0f));
-    glDisable(GL_BLEND); // Disable blending after text rendering
+    textRenderer->RenderText(label, textX, textY, textScale, glm::vec3(1.0f, 1.0f, 1.0f));
+}
 
-    glEnable(GL_DEPTH_TEST);
+void Game::publishFrame() {
+    FrameSnapshot& frame = frames.snapshot();
+    const BlackjackEngine& engine = session.getEngine();
+    const Hand& dealerHand = engine.getDealerHand();
+    frame.player = engine.getPlayerHand();
+    frame.dealer = dealerHand;
+    frame.holeCardHidden = !engine.isDealerRevealed();
+
+    // The dealer's newest card slides in from the shoe, interpolated
+    // between ticks so it moves smoothly at any frame rate
+    frame.dealerSlide = session.getDealerSlide();
+
+    // The dealer shows only the first card during player's turn
+    frame.playerScore = frame.player.getScore();
+    frame.dealerScore = frame.holeCardHidden ? dealerHand.front().getValue() : dealerHand.getScore();
+    std::size_t length = gameMessage.copy(frame.message, FrameSnapshot::kMessageSize - 1);
+    frame.message[length] = '\0';
+
+    RoundState state = engine.getState();
+    frame.buttonEnabled[FrameSnapshot::Hit] = state != RoundState::DealerTurn; // Hit deals anew once finished
+    frame.buttonEnabled[FrameSnapshot::Stand] = state == RoundState::PlayerTurn;
+    frame.buttonEnabled[FrameSnapshot::Restart] = state == RoundState::Finished;
+    frames.publish();
 }
 
-void Game::render() {
+void Game::render(const FrameSnapshot& frame) {
+    // Screen-space pixels for text; uploads only if it ever changes
+    frameUniforms.update({ glm::ortho(0.0f, 1280.0f, 0.0f, 960.0f) });
+
     glClearColor(0.2f, 0.5f, 0.2f, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    // Enable depth testing for cards and buttons
-    glEnable(GL_DEPTH_TEST);
+    // Cards and buttons are opaque. Every sprite sits at z = 0, so they stack
+    // by SpriteBatch layer, not by depth test
+    GLState::current().setDepthTest(false);
+    GLState::current().setBlend(false);
 
     // Render cards
-    shader->use();
-    renderCards(playerHand, -0.8f, 0.5f, false);
+    renderCards(frame.player, -0.8f, 0.5f, false);
 
     // Hide dealer's second card during player's turn
-    if (playerTurn) {
-        renderCards(dealerHand, -0.8f, -0.2f, true); // Hide the second card
+    if (frame.holeCardHidden) {
+        renderCards(frame.dealer, -0.8f, -0.2f, true); // Hide the second card
     }
     else {
-        renderCards(dealerHand, -0.8f, -0.2f, false); // Show all cards
+        renderCards(frame.dealer, -0.8f, -0.2f, false, frame.dealerSlide); // Show all cards
     }
 
     // Render buttons
-    renderButton(-0.75f, -0.8f, "cardBack", "HIT");
-    renderButton(-0.25f, -0.8f, "cardBack", "STAND");
-    renderButton(0.25f, -0.8f, "cardBack", "RESTART");
-
-    // Render text (disable depth testing and enable blending)
-    glDisable(GL_DEPTH_TEST);
+    renderButton(-0.75f, -0.8f, kCardBackSlot, "HIT", frame.buttonEnabled[FrameSnapshot::Hit]);
+    renderButton(-0.25f, -0.8f, kCardBackSlot, "STAND", frame.buttonEnabled[FrameSnapshot::Stand]);
+    renderButton(0.25f, -0.8f, kCardBackSlot, "RESTART", frame.buttonEnabled[FrameSnapshot::Restart]);
+    spriteBatch.flush();
+
+    // Scores; the strings are rebuilt only when a score changes
+    if (frame.playerScore != shownPlayerScore) {
+        shownPlayerScore = frame.playerScore;
+        playerScoreText = "Player Score: " + std::to_string(shownPlayerScore);
+    }
+    if (frame.dealerScore != shownDealerScore) {
+        shownDealerScore = frame.dealerScore;
+        dealerScoreText = "Dealer Score: " + std::to_string(shownDealerScore);
+    }
+    textRenderer->RenderText(playerScoreText, 10.0f, 920.0f, 1.0f, glm::vec3(1.0f, 1.0f, 1.0f));
+    textRenderer->RenderText(dealerScoreText, 10.0f, 880.0f, 1.0f, glm::vec3(1.0f, 1.0f, 1.0f));
 
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    std::string_view message(frame.message);
+    if (!message.empty()) {
+        float messageWidth = textRenderer->MeasureText(message, 1.0f);
+        textRenderer->RenderText(message, 640.0f - messageWidth / 2.0f, 480.0f, 1.0f, glm::vec3(1.0f, 1.0f, 1.0f));
+    }
 
-    // Player's score
-    textShader->use();
-    textRenderer->RenderText(*textShader, "Player Score: " + std::to_string(calculateScore(playerHand)), 10.0f, 920.0f, 1.0f, glm::vec3(1.0f, 1.0f, 1.0f));
+    // Draw every queued string at once, blended
+    GLState::current().setBlend(true);
+    GLState::current().setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    textRenderer->Flush(*textShader);
+    GLState::current().setBlend(false); // Cards are drawn opaque
+}
 
-    // Dealer's score: Show only the first card during player's turn
-    if (playerTurn) {
-        textRenderer->RenderText(*textShader, "Dealer Score: " + std::to_string(calculateScore({ dealerHand.front() })), 10.0f, 880.0f, 1.0f, glm::vec3(1.0f, 1.0f, 1.0f));
+void Game::renderLoop(GLFWwindow* window) {
+    glfwMakeContextCurrent(window);
+    if (!initializeGraphics()) {
+        // Nothing can be drawn; have the main thread close the window,
+        // since GLFW window state belongs to it
+        renderFailed = true;
+        glfwPostEmptyEvent();
+        glfwMakeContextCurrent(nullptr);
+        return;
     }
-    else {
-        textRenderer->RenderText(*textShader, "Dealer Score: " + std::to_string(calculateScore(dealerHand)), 10.0f, 880.0f, 1.0f, glm::vec3(1.0f, 1.0f, 1.0f));
+
+    // Draws the newest snapshot each time one arrives; ones published
+    // while this thread was busy are skipped, never waited for
+    while (const FrameSnapshot* frame = frames.waitLatest()) {
+        auto start = std::chrono::steady_clock::now();
+        render(*frame);
+        glfwSwapBuffers(window);
+        renderSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
     }
 
-    if (!gameMessage.empty()) {
-        textRenderer->RenderText(*textShader, gameMessage, 640.0f - (gameMessage.size() * 10.0f), 480.0f, 1.0f, glm::vec3(1.0f, 1.0f, 1.0f));
+    shutdownGraphics();
+    glfwMakeContextCurrent(nullptr);
+}
+
+bool Game::initializeGraphics() {
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cerr << "Failed to initialize GLAD!" << std::endl;
+        return false;
     }
 
-    glDisable(GL_BLEND); // Disable blending after text rendering
+    shader = new Shader(vertexShaderSource, fragmentShaderSource);
+    textShader = new Shader(TextvertexShaderSource, TextfragmentShaderSource);
+    // Samplers read texture unit 0 throughout, so they are set once here
+    shader->use();
+    shader->setInt("texture1", 0);
+    textShader->use();
+    textShader->setInt("text", 0);
+    frameUniforms.create();
+    textShader->bindUniformBlock(FrameUniforms::kBlockName, FrameUniforms::kBinding);
+
+    initializeDeck();
+    initializeCardRendering();
+    loadAssets();
+    return true;
 }
 
+void Game::shutdownGraphics() {
+    textureCache.clear();
+    frameUniforms.destroy();
+    spriteBatch.destroy();
+    wallRenderer.destroy();
+    textRenderer->Destroy();
+    delete textRenderer;
+    textRenderer = nullptr;
+    delete textShader;
+    delete shader;
+    textShader = shader = nullptr;
+    GLState::current().invalidate(); // The program names may be reused
+}
 
+void Game::runWall(GLFWwindow* window) {
+    // The wall's instances are rewritten in place as tables change, which
+    // a per-frame snapshot would have to copy whole; it stays on one thread
+    glfwMakeContextCurrent(window);
+    if (!initializeGraphics()) return;
 
+    wallEngines.reserve(wallTables);
+    for (int table = 0; table < wallTables; ++table) wallEngines.emplace_back(table + 1);
+    wall.layout(wallTables);
+    wallRenderer.create(atlas);
+
+    // The wall's tables play on their own, so it animates for good
+    FramePacer& pacer = session.getPacer();
+    pacer.setAnimating(true);
+    while (!glfwWindowShouldClose(window)) {
+        glfwWaitEventsTimeout(pacer.waitTimeout());
+        for (int due = session.getTicks().advance(glfwGetTime()); due > 0; --due) tickWall();
+        if (updateWall()) pacer.markDirty();
+        if (!pacer.beginFrame()) continue;
+
+        renderWall();
+        glfwSwapBuffers(window);
+    }
+    std::cout << "Frames rendered: " << pacer.getCounters().rendered
+              << ", wakeups skipped: " << pacer.getCounters().skipped << std::endl;
+    shutdownGraphics();
+}
 
 void Game::run() {
     if (!glfwInit()) {
@@ -546,32 +497,50 @@ void Game::run() {
         return;
     }
 
-    glfwMakeContextCurrent(window);
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
-        std::cerr << "Failed to initialize GLAD!" << std::endl;
-        return;
-    }
-
     glfwSetWindowUserPointer(window, this);
     glfwSetMouseButtonCallback(window, mouseButtonCallback);
+    glfwSetWindowRefreshCallback(window, windowRefreshCallback);
 
-    shader = new Shader(vertexShaderSource, fragmentShaderSource);
-    textShader = new Shader(TextvertexShaderSource, TextfragmentShaderSource);
+    if (wallTables > 0) {
+        runWall(window);
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return;
+    }
 
-    initializeDeck();
-    shuffleDeck();
-    initializeCardRendering();
-    loadAssets();
+    // Input and rules stay on this thread, which GLFW needs for events;
+    // the render thread owns the GL context and draws published snapshots
     resetGame();
-
+    std::thread renderer(&Game::renderLoop, this, window);
     while (!glfwWindowShouldClose(window)) {
+        // Sleep until input arrives, the next animation frame is due or
+        // the idle timeout passes, instead of spinning
+        glfwWaitEventsTimeout(session.getPacer().waitTimeout());
+        if (renderFailed) {
+            glfwSetWindowShouldClose(window, GLFW_TRUE);
+            break;
+        }
+
+        // Logic catches up with the clock in fixed steps, so it runs at the
+        // same speed on a 60 Hz and a 240 Hz display
+        if (session.advance(glfwGetTime())) {
+            const BlackjackEngine& engine = session.getEngine();
+            std::cout << "Player Score: " << engine.getPlayerHand().getScore()
+                      << ", Dealer Score: " << engine.getDealerHand().getScore() << std::endl;
+        }
         handleInput(window);
         update();
-        render();
-
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+        if (session.getPacer().beginFrame()) publishFrame(); // Never waits for the renderer
     }
+    frames.close();
+    renderer.join();
+
+    FrameChannel::Counters counters = frames.getCounters();
+    std::cout << "Snapshots published: " << counters.published << ", rendered: " << counters.rendered
+              << ", dropped: " << counters.dropped
+              << ", wakeups skipped: " << session.getPacer().getCounters().skipped
+              << ", render thread " << (counters.rendered ? renderSeconds / counters.rendered * 1000.0 : 0.0)
+              << " ms per frame" << std::endl;
 
     glfwDestroyWindow(window);
     glfwTerminate();
@@ -1,55 +1,80 @@
 #ifndef GAME_H
 #define GAME_H
 
+#include <atomic>
+#include <thread>
 #include <vector>
 #include <map>
 #include <string>
+#include <string_view>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
-#include <random>
-#include "Card.h"
+#include "engine/BlackjackEngine.h"
 #include "Shader.h"
+#include "SpriteBatch.h"
+#include "CardAtlas.h"
+#include "FrameUniforms.h"
+#include "FrameChannel.h"
+#include "TableSession.h"
+#include "TableWall.h"
+#include "TableWallRenderer.h"
+#include "TextureCache.h"
 
 class Game {
 public:
-    Game();
+    explicit Game(int wallTables = 0); // Tables > 0 shows an auto-playing table wall instead
     void run();
     void handleMouseClick(float mouseX, float mouseY);
+    void requestRedraw() { session.getPacer().markDirty(); } // The window needs its contents again, e.g. after a resize
 private:
+    bool initializeGraphics(); // With the window's context current; false if GL could not be loaded
+    void shutdownGraphics();
     void loadAssets();
-    GLuint loadTexture(const char* path);
+    TextureCache::Handle loadTexture(const char* path);
     void initializeCardRendering();
     void initializeDeck();
-    void shuffleDeck();
-    void dealInitialCards();
     void resetGame();
-    void resetDeck();
 
-    void render();
-    void renderCards(const std::vector<Card>& hand, float startX, float startY, bool hideSecondCard);
-    void renderButton(float x, float y, const std::string& textureKey, const std::string& label);
+    void publishFrame();                      // Logic thread: snapshot the table for the render thread
+    void renderLoop(GLFWwindow* window);      // Render thread: owns the GL context
+    void render(const FrameSnapshot& frame);
+    void renderCards(const Hand& hand, float startX, float startY, bool hideSecondCard, float lastCardSlide = 1.0f);
+    void renderButton(float x, float y, int atlasSlot, std::string_view label, bool enabled);
     void handleInput(GLFWwindow* window);
-   
-    void update();
+    void press(TableSession::Action action); // A button or key press, reported on the console
 
-    int calculateScore(const std::vector<Card>& hand);
-    void dealCard(std::vector<Card>& hand);
+    void update();     // Once per loop pass, after the ticks
+
+    void runWall(GLFWwindow* window);         // The wall renders on the main thread, see run()
+    void tickWall();
+    bool updateWall(); // True if any table changed
+    void renderWall();
 
     Shader* shader;                       // Shader program for rendering
     Shader* textShader;                       // Shader program for rendering
-    std::map<std::string, GLuint> textures; // Card textures
-    std::vector<Card> playerHand;          // Player's cards
-    std::vector<Card> dealerHand;          // Dealer's cards
-    std::vector<Card> deck;                // Deck of cards
-    int gameState;                         // 0: Menu, 1: Playing, 2: Game Over
-    bool playerTurn;                       // Is it the player's turn?
-
-    GLuint VAO, VBO, EBO;                  // VAO and VBO for card rendering
-    std::mt19937 rng;                      // Random number generator for shuffling
-    bool deckEmpty;                        // Indicates if the deck is empty
+    TextureCache textureCache;             // Every texture the game loads
+    FrameUniforms frameUniforms;           // Projection and other per-frame shader inputs
+    FrameChannel frames;                   // Snapshots from the logic thread to the render thread
+    double renderSeconds;                  // Render thread time spent drawing and presenting
+    std::atomic<bool> renderFailed{ false }; // Set by the render thread when GL could not be set up
+    TextureCache::Handle atlasTexture;     // Every card face and back, see CardAtlas
+    CardAtlas atlas;                       // Where each card sits in atlasTexture
+    TableSession session;                  // Rules, logic ticks and frame pacing of the table
+    unsigned long long announcedRound;     // Last round whose result is in gameMessage
+    int shownPlayerScore, shownDealerScore; // Scores in the text below
+    std::string playerScoreText;           // Score lines, rebuilt only when a score changes
+    std::string dealerScoreText;
+
+    SpriteBatch spriteBatch;               // Cards and button backgrounds, drawn together
+
+    int wallTables;                        // 0 outside wall mode
+    std::vector<BlackjackEngine> wallEngines; // One per table on the wall
+    TableWall wall;
+    TableWallRenderer wallRenderer;
+    unsigned long long wallTick;
 
     static const std::string vertexShaderSource;
     static const std::string fragmentShaderSource;
@@ -1,8 +1,12 @@
-
 #include "Game.h"
+#include <cstdlib>
+#include <cstring>
 
-int main() {
-    Game game;
+// Usage: Blackjack [--wall tables]
+int main(int argc, char** argv) {
+    int wallTables = 0;
+    if (argc > 2 && std::strcmp(argv[1], "--wall") == 0) wallTables = std::atoi(argv[2]);
+    Game game(wallTables);
     game.run();
     return 0;
 }
@@ -1,7 +1,10 @@
 #include "Shader.h"
+#include "GLState.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <vector>
+#include <glm/gtc/type_ptr.hpp>
 
 Shader::Shader(const std::string& vertexSource, const std::string& fragmentSource) {
     // Compile vertex shader
@@ -24,20 +27,80 @@ Shader::Shader(const std::string& vertexSource, const std::string& fragmentSourc
     glAttachShader(ID, fragmentShader);
     glLinkProgram(ID);
     checkCompileErrors(ID, "PROGRAM");
+    reflectUniforms();
 
     // Delete shaders as they're no longer needed
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
 }
 
+Shader::~Shader() {
+    glDeleteProgram(ID);
+}
+
 void Shader::use() const {
-    glUseProgram(ID);
+    GLState::current().useProgram(ID);
 }
 
 GLuint Shader::getID() const {
     return ID;
 }
 
+GLint Shader::getUniformLocation(std::string_view name) const {
+    auto range = uniformLocations.equal_range(hashName(name));
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second.name == name) return it->second.location;
+    }
+    return -1;
+}
+
+void Shader::setInt(std::string_view name, GLint value) const {
+    glUniform1i(getUniformLocation(name), value);
+}
+
+void Shader::setVec4(std::string_view name, const glm::vec4& value) const {
+    glUniform4f(getUniformLocation(name), value.x, value.y, value.z, value.w);
+}
+
+void Shader::setMat4(std::string_view name, const glm::mat4& value) const {
+    glUniformMatrix4fv(getUniformLocation(name), 1, GL_FALSE, glm::value_ptr(value));
+}
+
+void Shader::bindUniformBlock(const char* blockName, GLuint binding) const {
+    GLuint index = glGetUniformBlockIndex(ID, blockName);
+    if (index == GL_INVALID_INDEX) {
+        std::cerr << "Shader has no uniform block " << blockName << std::endl;
+        return;
+    }
+    glUniformBlockBinding(ID, index, binding);
+}
+
+void Shader::reflectUniforms() {
+    // The only time uniform names are passed to the driver
+    GLint count = 0, maxLength = 0;
+    glGetProgramiv(ID, GL_ACTIVE_UNIFORMS, &count);
+    glGetProgramiv(ID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+    std::vector<GLchar> name(static_cast<size_t>(maxLength) + 1);
+    for (GLint i = 0; i < count; ++i) {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(ID, static_cast<GLuint>(i), static_cast<GLsizei>(name.size()), &length, &size, &type, name.data());
+        std::string_view uniform(name.data(), static_cast<size_t>(length));
+        GLint location = glGetUniformLocation(ID, name.data());
+        if (location < 0) continue; // Member of a uniform block
+        if (uniform.size() > 3 && uniform.substr(uniform.size() - 3) == "[0]") uniform.remove_suffix(3);
+        uniformLocations.emplace(hashName(uniform), Uniform{ std::string(uniform), location });
+    }
+}
+
+std::uint32_t Shader::hashName(std::string_view name) {
+    // FNV-1a
+    std::uint32_t hash = 0x811C9DC5u;
+    for (char c : name) hash = (hash ^ static_cast<unsigned char>(c)) * 0x01000193u;
+    return hash;
+}
+
 void Shader::checkCompileErrors(GLuint shader, const std::string& type) {
     GLint success;
     GLchar infoLog[1024];
@@ -1,18 +1,47 @@
 #ifndef SHADER_H
 #define SHADER_H
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <glad/glad.h>
+#include <glm/glm.hpp>
 
+// A linked GL program. Its active uniforms are reflected once after link
+// into a table keyed by a hash of the name, so looking one up never asks
+// the driver. Setters act on the program currently in use; a name the
+// program does not have resolves to -1, which GL ignores.
 class Shader {
 public:
     Shader(const std::string& vertexSource, const std::string& fragmentSource);
+    ~Shader(); // Deletes the program; the GL context must be current
+    Shader(const Shader&) = delete;
+    Shader& operator=(const Shader&) = delete;
     void use() const;
     GLuint getID() const;
 
+    GLint getUniformLocation(std::string_view name) const;
+    size_t getUniformCount() const { return uniformLocations.size(); }
+
+    void setInt(std::string_view name, GLint value) const;
+    void setVec4(std::string_view name, const glm::vec4& value) const;
+    void setMat4(std::string_view name, const glm::mat4& value) const;
+
+    // Reads the named std140 uniform block from buffer binding point `binding`
+    void bindUniformBlock(const char* blockName, GLuint binding) const;
+
 private:
     GLuint ID;
+    struct Uniform {
+        std::string name; // Compared on lookup, so a name that only shares a hash misses
+        GLint location;
+    };
+    std::unordered_multimap<std::uint32_t, Uniform> uniformLocations; // Keyed by hashName; names that collide share a key
     void checkCompileErrors(GLuint shader, const std::string& type);
+    void reflectUniforms();
+    static std::uint32_t hashName(std::string_view name);
 };
 
 #endif
@@ -0,0 +1,107 @@
+#include "SpriteBatch.h"
+#include <algorithm>
+#include "GLState.h"
+
+namespace {
+
+std::uint32_t packColor(const glm::vec4& color) {
+    glm::vec4 clamped = glm::clamp(color, 0.0f, 1.0f) * 255.0f + 0.5f;
+    return static_cast<std::uint32_t>(clamped.r) | static_cast<std::uint32_t>(clamped.g) << 8 |
+           static_cast<std::uint32_t>(clamped.b) << 16 | static_cast<std::uint32_t>(clamped.a) << 24;
+}
+
+}
+
+void SpriteBatch::create() {
+    // Every quad is corners 0-1-2, 2-3-0 of its own four vertices, so one
+    // index buffer serves all draws with a base vertex
+    std::vector<std::uint16_t> indices(static_cast<size_t>(kMaxQuadsPerDraw) * 6);
+    for (int quad = 0; quad < kMaxQuadsPerDraw; ++quad) {
+        std::uint16_t first = static_cast<std::uint16_t>(quad * 4);
+        std::uint16_t* out = &indices[static_cast<size_t>(quad) * 6];
+        out[0] = first;
+        out[1] = first + 1;
+        out[2] = first + 2;
+        out[3] = first + 2;
+        out[4] = first + 3;
+        out[5] = first;
+    }
+
+    glGenVertexArrays(1, &vertexArray);
+    glGenBuffers(1, &indexBuffer);
+    GLState::current().bindVertexArray(vertexArray);
+    vertexBuffer.create(static_cast<GLsizeiptr>(kStreamQuads) * 4 * sizeof(SpriteVertex));
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(std::uint16_t), indices.data(), GL_STATIC_DRAW);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), (void*)0);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(SpriteVertex), (void*)(2 * sizeof(float)));
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SpriteVertex), (void*)(4 * sizeof(float)));
+}
+
+void SpriteBatch::destroy() {
+    vertexBuffer.destroy();
+    if (indexBuffer) glDeleteBuffers(1, &indexBuffer);
+    if (vertexArray) glDeleteVertexArrays(1, &vertexArray);
+    GLState::current().invalidate(); // The vertex array name may be reused
+    vertexArray = indexBuffer = 0;
+    sprites.clear();
+}
+
+void SpriteBatch::draw(const Shader& shader, GLuint texture, glm::vec2 center, glm::vec2 size, const AtlasRect& uv,
+                       const glm::vec4& tint, int layer) {
+    glm::vec2 half = size * 0.5f;
+    std::uint32_t color = packColor(tint);
+    // v = 0 is the top row of the image, so the top edge gets uv.v
+    Sprite sprite = { &shader, texture, {
+        { center.x - half.x, center.y + half.y, uv.u,            uv.v,             color },
+        { center.x + half.x, center.y + half.y, uv.u + uv.width, uv.v,             color },
+        { center.x + half.x, center.y - half.y, uv.u + uv.width, uv.v + uv.height, color },
+        { center.x - half.x, center.y - half.y, uv.u,            uv.v + uv.height, color }
+    } };
+    std::uint64_t key = static_cast<std::uint64_t>(static_cast<std::uint16_t>(layer + 0x8000)) << 48 |
+                        static_cast<std::uint64_t>(shader.getID() & 0xFFFF) << 32 | texture;
+    order.emplace_back(key, static_cast<std::uint32_t>(sprites.size()));
+    sprites.push_back(sprite);
+}
+
+void SpriteBatch::flush() {
+    frameStats = SpriteFrameStats();
+    frameStats.sprites = static_cast<unsigned int>(sprites.size());
+    if (sprites.empty()) return;
+
+    // The index breaks ties, so queue order survives within a run. The
+    // table queues in order already, which is_sorted confirms in one pass.
+    if (!std::is_sorted(order.begin(), order.end())) std::sort(order.begin(), order.end());
+
+    GLsizeiptr bytes = static_cast<GLsizeiptr>(sprites.size() * 4 * sizeof(SpriteVertex));
+    SpriteVertex* out = static_cast<SpriteVertex*>(vertexBuffer.map(bytes));
+    if (!out) {
+        sprites.clear();
+        order.clear();
+        return;
+    }
+    for (const auto& entry : order) out = std::copy(sprites[entry.second].corners, sprites[entry.second].corners + 4, out);
+    GLint firstVertex = vertexBuffer.unmap(sizeof(SpriteVertex));
+    frameStats.uploadBytes = static_cast<size_t>(bytes);
+
+    GLState::current().bindVertexArray(vertexArray);
+    size_t runStart = 0;
+    for (size_t i = 1; i <= order.size(); ++i) {
+        const Sprite& first = sprites[order[runStart].second];
+        if (i < order.size() && order[i].first == order[runStart].first && sprites[order[i].second].shader == first.shader &&
+            i - runStart < kMaxQuadsPerDraw) {
+            continue;
+        }
+        first.shader->use();
+        GLState::current().bindTexture(first.texture);
+        glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>((i - runStart) * 6), GL_UNSIGNED_SHORT, (void*)0,
+                                 firstVertex + static_cast<GLint>(runStart * 4));
+        ++frameStats.drawCalls;
+        runStart = i;
+    }
+    sprites.clear();
+    order.clear();
+}
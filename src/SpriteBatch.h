@@ -0,0 +1,65 @@
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include "CardAtlas.h"
+#include "Shader.h"
+#include "StreamBuffer.h"
+
+// One corner of a sprite in the frame's vertex stream
+struct SpriteVertex {
+    float x, y;         // Normalized device coordinates
+    float u, v;         // Texture coordinates
+    std::uint32_t tint; // RGBA8, multiplied with the texel
+};
+
+// What the last flush sent to GL
+struct SpriteFrameStats {
+    unsigned int sprites = 0;
+    unsigned int drawCalls = 0;
+    size_t uploadBytes = 0;
+};
+
+// Collects a frame's textured quads and draws them in as few calls as
+// possible. draw() only appends the quad's four transformed corners;
+// flush() orders the quads by layer, then program, then texture, writes
+// them into a streaming ring buffer with one upload and issues one draw per
+// run of quads that share all three. Quads in one layer may be reordered,
+// so sprites that overlap and must stack go in different layers.
+// Call create() and destroy() with the GL context current.
+class SpriteBatch {
+public:
+    static const int kMaxQuadsPerDraw = 16384;        // 16-bit indices
+    static const int kStreamQuads = 4096;             // Ring size; grows if a frame needs more
+
+    void create();
+    void destroy();
+
+    // A `size` quad centred on `center`, showing `uv` of `texture`
+    void draw(const Shader& shader, GLuint texture, glm::vec2 center, glm::vec2 size, const AtlasRect& uv,
+              const glm::vec4& tint = glm::vec4(1.0f), int layer = 0);
+    void flush();
+
+    const SpriteFrameStats& getFrameStats() const { return frameStats; }
+
+private:
+    struct Sprite {
+        const Shader* shader;
+        GLuint texture;
+        SpriteVertex corners[4];
+    };
+
+    std::vector<Sprite> sprites;                            // Queued since the last flush
+    std::vector<std::pair<std::uint64_t, std::uint32_t>> order; // (sort key, index into sprites)
+    GLuint vertexArray = 0;
+    StreamBuffer vertexBuffer;
+    GLuint indexBuffer = 0;
+    SpriteFrameStats frameStats;
+};
+
+#endif
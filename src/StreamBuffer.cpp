@@ -0,0 +1,43 @@
+#include "StreamBuffer.h"
+#include <algorithm>
+#include "GLState.h"
+
+void StreamBuffer::create(GLsizeiptr bytes) {
+    capacity = bytes;
+    offset = 0;
+    glGenBuffers(1, &buffer);
+    GLState::current().bindArrayBuffer(buffer);
+    glBufferData(GL_ARRAY_BUFFER, capacity, NULL, GL_STREAM_DRAW);
+}
+
+void StreamBuffer::destroy() {
+    if (buffer) {
+        glDeleteBuffers(1, &buffer);
+        GLState::current().bufferDeleted(buffer);
+    }
+    buffer = 0;
+    capacity = offset = mapped = 0;
+}
+
+void* StreamBuffer::map(GLsizeiptr bytes) {
+    GLState::current().bindArrayBuffer(buffer);
+    if (offset + bytes > capacity) {
+        // Orphan the storage: the driver hands back fresh memory while
+        // earlier frames still draw from the old block
+        capacity = std::max(capacity, bytes);
+        glBufferData(GL_ARRAY_BUFFER, capacity, NULL, GL_STREAM_DRAW);
+        offset = 0;
+    }
+    void* target = glMapBufferRange(GL_ARRAY_BUFFER, offset, bytes,
+                                    GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    mapped = target ? bytes : 0;
+    return target;
+}
+
+GLint StreamBuffer::unmap(size_t vertexSize) {
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    GLint first = static_cast<GLint>(offset / static_cast<GLsizeiptr>(vertexSize));
+    offset += mapped;
+    mapped = 0;
+    return first;
+}
@@ -0,0 +1,32 @@
+#ifndef STREAM_BUFFER_H
+#define STREAM_BUFFER_H
+
+#include <cstddef>
+#include <glad/glad.h>
+
+// A GL_ARRAY_BUFFER written as a ring: each frame's vertices go after the
+// previous frame's, mapped unsynchronized since nothing queued reads that
+// range. A frame that does not fit in what is left orphans the storage
+// and starts over at the front, growing it if the frame alone is bigger.
+// Each instance is its own GL buffer; SpriteBatch and TextRenderer keep one apiece.
+// Call create() and destroy() with the GL context current.
+class StreamBuffer {
+public:
+    // Leaves the buffer bound, so a vertex array bound beforehand can point its attributes at it
+    void create(GLsizeiptr capacity);
+    void destroy();
+
+    // Binds the buffer and maps `bytes` of it for writing; nullptr if GL refused
+    void* map(GLsizeiptr bytes);
+    // Ends the write started by map() and returns the index of its first
+    // vertex, `vertexSize` bytes each
+    GLint unmap(size_t vertexSize);
+
+private:
+    GLuint buffer = 0;
+    GLsizeiptr capacity = 0;  // Bytes in buffer
+    GLsizeiptr offset = 0;    // Where the next frame's vertices go
+    GLsizeiptr mapped = 0;    // Bytes of the current map() at offset
+};
+
+#endif
@@ -0,0 +1,63 @@
+#include "TableSession.h"
+#include <algorithm>
+
+TableSession::TableSession(std::uint64_t seed)
+    : engine(seed), ticks(kTickRate), dealerTicks(kDealerDrawTicks), dealerSettled(false) {}
+
+bool TableSession::advance(double now) {
+    dealerSettled = false;
+    for (int due = ticks.advance(now); due > 0; --due) tick();
+    return dealerSettled;
+}
+
+void TableSession::tick() {
+    if (dealerTicks < kDealerDrawTicks) ++dealerTicks;
+    if (engine.getState() != RoundState::DealerTurn || dealerTicks < kDealerDrawTicks) return;
+
+    // Dealer draws one card every kDealerDrawTicks ticks
+    int dealt = engine.getDealerHand().size();
+    if (!engine.dealerStep() && engine.getState() == RoundState::Finished) dealerSettled = true;
+    if (engine.getDealerHand().size() != dealt) dealerTicks = 0; // The new card starts sliding in
+    pacer.markDirty();
+}
+
+bool TableSession::press(Action action) {
+    RoundState state = engine.getState();
+    if (state == RoundState::Finished && action != Action::Stand) {
+        newRound();
+        return true;
+    }
+    if (state != RoundState::PlayerTurn || action == Action::Restart) return false;
+    if (action == Action::Hit) engine.hit();
+    else engine.stand(); // End the player's turn
+    pacer.markDirty();
+    return true;
+}
+
+void TableSession::newRound() {
+    engine.startRound();
+    dealerTicks = kDealerDrawTicks;
+    pacer.markDirty();
+}
+
+void TableSession::resetDeck() {
+    engine.resetDeck();
+    dealerTicks = kDealerDrawTicks; // Nothing slides into a fresh deal
+    pacer.markDirty();
+}
+
+bool TableSession::update() {
+    bool reshuffled = engine.cardsLeft() == 0 && engine.getState() == RoundState::Finished;
+    if (reshuffled) resetDeck();
+
+    // The dealer's draws are the only thing that moves without input
+    bool sliding = dealerTicks < kDealerDrawTicks;
+    if (sliding) pacer.markDirty(); // Interpolated, so it moves every frame
+    pacer.setAnimating(engine.getState() == RoundState::DealerTurn || sliding);
+    return reshuffled;
+}
+
+float TableSession::getDealerSlide() const {
+    if (dealerTicks >= kDealerDrawTicks) return 1.0f;
+    return std::min(1.0f, static_cast<float>((dealerTicks + ticks.getAlpha()) / kDealerDrawTicks));
+}
@@ -0,0 +1,59 @@
+#ifndef TABLE_SESSION_H
+#define TABLE_SESSION_H
+
+#include <cstdint>
+#include <random>
+#include "engine/BlackjackEngine.h"
+#include "FramePacer.h"
+#include "TickScheduler.h"
+
+// The single table's rules and timing, without a window or GL: the logic
+// ticks, the dealer's paced draws, what each button does in each state and
+// when the table needs a new frame. Game::run drives it from GLFW and
+// FramePacerBench from a scripted clock, so the bench checks the game's own
+// pacing rather than a copy of it.
+class TableSession {
+public:
+    static constexpr double kTickRate = 30.0; // Logic steps per second, whatever the refresh rate
+    // The dealer draws a card every this many ticks; each card slides in
+    // from the shoe over that time
+    static const int kDealerDrawTicks = 8;
+
+    enum class Action { Hit, Stand, Restart };
+
+    explicit TableSession(std::uint64_t seed = std::random_device{}());
+
+    // Runs the logic ticks due at `now`, in seconds. True if the dealer
+    // settled the round during them.
+    bool advance(double now);
+
+    // A button or key press. Hit deals the next round once the round is
+    // finished; Restart only does that. False if the press does nothing now.
+    bool press(Action action);
+    void newRound();  // Deal the next round, reshuffling first once the cut card is out
+    void resetDeck(); // Reshuffle the whole shoe, then deal
+
+    // Once per loop pass, after the ticks and input: deals from a fresh
+    // shoe once a finished round emptied it, and tells the pacer whether the
+    // table is moving. True if it reshuffled.
+    bool update();
+
+    // How far the dealer's newest card has slid in from the shoe, 1 once it
+    // has landed; interpolated between ticks
+    float getDealerSlide() const;
+
+    const BlackjackEngine& getEngine() const { return engine; }
+    FramePacer& getPacer() { return pacer; }
+    TickScheduler& getTicks() { return ticks; }
+
+private:
+    void tick();
+
+    BlackjackEngine engine;  // Rules, deck and hands
+    FramePacer pacer;        // Renders only frames something changed
+    TickScheduler ticks;     // Paces the logic independently of the frame rate
+    int dealerTicks;         // Ticks since the dealer's last card, up to kDealerDrawTicks
+    bool dealerSettled;      // Set by tick() when the dealer finishes the round
+};
+
+#endif
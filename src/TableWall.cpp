@@ -0,0 +1,112 @@
+#include "TableWall.h"
+#include <algorithm>
+#include <cmath>
+#include "CardAtlas.h"
+
+namespace {
+
+// Offset of each card in a hand, in card widths: the first cards fan out
+// half a card apart, later ones bunch up so a 21-card hand still fits
+float fanOffset(int card) {
+    const int kWideCards = 6;
+    return 0.5f * std::min(card, kWideCards - 1) + 0.1f * std::max(0, card - (kWideCards - 1));
+}
+
+}
+
+void TableWall::layout(int tables, int columns) {
+    tables = std::max(0, tables);
+    if (columns <= 0) columns = std::max(1, static_cast<int>(std::ceil(std::sqrt(tables * 4.0 / 3.0))));
+    int rows = std::max(1, (tables + columns - 1) / columns);
+    float cellWidth = 2.0f / columns;
+    float cellHeight = 2.0f / rows;
+
+    // Card proportions of the single-table view, shrunk until both hands
+    // fit their cell with the widest fan
+    const float kAspect = 0.216f / 0.336f;
+    cardHeight = cellHeight * 0.42f;
+    cardWidth = cardHeight * kAspect;
+    float fanWidth = 1.0f + fanOffset(kSlotsPerHand - 1);
+    if (cardWidth * fanWidth > cellWidth * 0.9f) {
+        cardWidth = cellWidth * 0.9f / fanWidth;
+        cardHeight = cardWidth / kAspect;
+    }
+
+    backSlot = CardAtlas::find("cardBack_blue1");
+    instances.assign(static_cast<std::size_t>(tables) * kSlotsPerTable, CardInstance());
+    for (int table = 0; table < tables; ++table) {
+        float left = -1.0f + (table % columns) * cellWidth + cellWidth * 0.05f + cardWidth * 0.5f;
+        float top = 1.0f - (table / columns) * cellHeight;
+        for (int hand = 0; hand < 2; ++hand) {
+            // Dealer above, player below, as at the single table
+            float y = top - cellHeight * (hand == 0 ? 0.27f : 0.73f);
+            for (int card = 0; card < kSlotsPerHand; ++card) {
+                CardInstance& instance = instances[static_cast<std::size_t>(table) * kSlotsPerTable + hand * kSlotsPerHand + card];
+                instance.x = left + fanOffset(card) * cardWidth;
+                instance.y = y;
+                instance.slot = kEmptySlot;
+            }
+        }
+    }
+    signatures.assign(tables, Signature());
+    dirty.assign(tables, DirtyRange());
+    dirtyTables.clear();
+    fullUpload = true;
+    cardWrites = 0;
+}
+
+void TableWall::setHands(int table, const Hand& player, const Hand& dealer, bool hideHoleCard) {
+    std::size_t base = static_cast<std::size_t>(table) * kSlotsPerTable;
+    for (int card = 0; card < kSlotsPerHand; ++card) {
+        std::int32_t slot = kEmptySlot;
+        if (card < dealer.size()) slot = (hideHoleCard && card == 1) ? backSlot : dealer[card].getIndex();
+        writeSlot(base + card, slot);
+    }
+    base += kSlotsPerHand;
+    for (int card = 0; card < kSlotsPerHand; ++card) {
+        writeSlot(base + card, card < player.size() ? player[card].getIndex() : kEmptySlot);
+    }
+}
+
+void TableWall::writeSlot(std::size_t index, std::int32_t slot) {
+    if (instances[index].slot == slot) return;
+    instances[index].slot = slot;
+    ++cardWrites;
+
+    int table = static_cast<int>(index / kSlotsPerTable);
+    DirtyRange& range = dirty[table];
+    if (range.begin == range.end) {
+        range.begin = index;
+        range.end = index + 1;
+        dirtyTables.push_back(table);
+    }
+    else {
+        range.begin = std::min(range.begin, index);
+        range.end = std::max(range.end, index + 1);
+    }
+}
+
+const std::vector<TableWall::Span>& TableWall::takeDirtySpans() {
+    spans.clear();
+    if (fullUpload) {
+        // Nothing has been uploaded since layout(), positions included
+        for (int table : dirtyTables) dirty[table] = DirtyRange();
+        dirtyTables.clear();
+        if (!instances.empty()) spans.push_back(Span{ 0, instances.size() });
+        fullUpload = false;
+        return spans;
+    }
+    std::sort(dirtyTables.begin(), dirtyTables.end());
+    for (int table : dirtyTables) {
+        DirtyRange& range = dirty[table];
+        if (!spans.empty() && range.begin <= spans.back().first + spans.back().count + kMergeGap) {
+            spans.back().count = range.end - spans.back().first;
+        }
+        else {
+            spans.push_back(Span{ range.begin, range.end - range.begin });
+        }
+        range = DirtyRange();
+    }
+    dirtyTables.clear();
+    return spans;
+}
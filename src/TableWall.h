@@ -0,0 +1,117 @@
+#ifndef TABLE_WALL_H
+#define TABLE_WALL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "engine/BlackjackEngine.h"
+
+// One card position on the wall; the instance data of TableWallRenderer
+struct CardInstance {
+    float x, y;          // Card centre in normalized device coordinates
+    std::int32_t slot;   // CardAtlas slot, or TableWall::kEmptySlot to draw nothing
+};
+
+static_assert(sizeof(CardInstance) == 12, "CardInstance is uploaded as is");
+
+// Card instances for a grid of live tables, the pit-boss "table wall".
+// Every table owns a fixed run of instances, one per possible card of the
+// dealer's hand and then the player's, so positions never move and a card
+// dealt or revealed rewrites one instance. Tables whose hands have not
+// changed are skipped after an O(1) check, so the work per frame follows
+// the number of changed cards rather than the number of tables. Changed
+// instances are reported as merged spans for partial buffer uploads.
+// No GL here; see TableWallRenderer.
+class TableWall {
+public:
+    static const int kSlotsPerHand = Hand::kMaxCards;
+    static const int kSlotsPerTable = 2 * kSlotsPerHand;
+    static const std::int32_t kEmptySlot = -1;
+    static const std::size_t kMergeGap = 64; // Dirty spans closer than this many instances upload as one
+
+    struct Span {
+        std::size_t first;
+        std::size_t count;
+    };
+
+    // Arranges `tables` tables in a grid over the whole viewport; 0 columns
+    // picks a grid close to the 4:3 window's shape. Every instance starts
+    // empty and dirty.
+    void layout(int tables, int columns = 0);
+
+    // Mirrors a table's current round. Returns false without touching any
+    // instance when nothing has been dealt or revealed since the last call.
+    template <typename Engine>
+    bool update(int table, const Engine& engine) {
+        const Hand& player = engine.getPlayerHand();
+        const Hand& dealer = engine.getDealerHand();
+        Signature signature = { engine.getRoundNumber(), player.size(), dealer.size(), engine.isDealerRevealed() };
+        if (signatures[table] == signature) return false;
+        signatures[table] = signature;
+        setHands(table, player, dealer, !engine.isDealerRevealed());
+        return true;
+    }
+    void setHands(int table, const Hand& player, const Hand& dealer, bool hideHoleCard);
+
+    // Instance ranges written since the last call, merged and in order
+    const std::vector<Span>& takeDirtySpans();
+
+    const std::vector<CardInstance>& getInstances() const { return instances; }
+    int getTableCount() const { return static_cast<int>(signatures.size()); }
+    float getCardWidth() const { return cardWidth; }
+    float getCardHeight() const { return cardHeight; }
+    unsigned long long getCardWrites() const { return cardWrites; } // Instances rewritten since layout()
+
+private:
+    struct Signature {
+        unsigned long long round = ~0ULL;
+        int playerCards = 0;
+        int dealerCards = 0;
+        bool revealed = false;
+
+        bool operator==(const Signature& other) const {
+            return round == other.round && playerCards == other.playerCards && dealerCards == other.dealerCards &&
+                   revealed == other.revealed;
+        }
+    };
+
+    // Instances of one table written since the last takeDirtySpans, [begin, end)
+    struct DirtyRange {
+        std::size_t begin = 0;
+        std::size_t end = 0;
+    };
+
+    void writeSlot(std::size_t index, std::int32_t slot);
+
+    std::vector<CardInstance> instances;
+    std::vector<Signature> signatures;  // Per table
+    std::vector<DirtyRange> dirty;      // Per table
+    std::vector<int> dirtyTables;
+    std::vector<Span> spans;
+    bool fullUpload = false;            // Every instance is new since layout()
+    std::int32_t backSlot = 0;
+    float cardWidth = 0.0f;
+    float cardHeight = 0.0f;
+    unsigned long long cardWrites = 0;
+};
+
+// One move of an unattended table, for the wall demo: a finished round is
+// redealt, the player hits below 17 and then stands, and the dealer draws
+// a card per call.
+template <typename Engine>
+void stepDemoTable(Engine& engine) {
+    switch (engine.getState()) {
+    case RoundState::Finished:
+        engine.startRound();
+        break;
+    case RoundState::PlayerTurn:
+        if (engine.getPlayerHand().getScore() < 17) engine.hit();
+        else engine.stand();
+        break;
+    case RoundState::DealerTurn:
+        engine.dealerStep();
+        break;
+    }
+}
+
+#endif
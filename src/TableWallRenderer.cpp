@@ -0,0 +1,112 @@
+#include "TableWallRenderer.h"
+#include "GLState.h"
+
+namespace {
+
+const char* kVertexSource = R"(
+    #version 330 core
+    layout (location = 0) in vec2 center;
+    layout (location = 1) in int slot;
+
+    out vec2 TexCoord;
+
+    uniform vec2 cardSize;
+    uniform vec4 uvRects[68]; // CardAtlas::kSlots cells: offset, size
+
+    void main() {
+        // Triangle strip corners 0-3: top-left, top-right, bottom-left, bottom-right
+        vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+        TexCoord = uvRects[max(slot, 0)].xy + corner * uvRects[max(slot, 0)].zw;
+        gl_Position = vec4(center + (corner - 0.5) * vec2(1.0, -1.0) * cardSize, 0.0, 1.0);
+        if (slot < 0) gl_Position = vec4(2.0, 2.0, 2.0, 1.0); // Empty: all corners collapse off screen
+    }
+)";
+
+const char* kFragmentSource = R"(
+    #version 330 core
+    out vec4 FragColor;
+
+    in vec2 TexCoord;
+    uniform sampler2D texture1;
+
+    void main() {
+        FragColor = texture(texture1, TexCoord);
+    }
+)";
+
+}
+
+static_assert(CardAtlas::kSlots == 68, "uvRects in the wall shader must match CardAtlas::kSlots");
+
+void TableWallRenderer::create(const CardAtlas& atlas) {
+    shader.reset(new Shader(kVertexSource, kFragmentSource));
+    shader->use();
+    shader->setInt("texture1", 0);
+    GLfloat rects[CardAtlas::kSlots * 4];
+    for (int slot = 0; slot < CardAtlas::kSlots; ++slot) {
+        const AtlasRect& rect = atlas.getRect(slot);
+        rects[slot * 4 + 0] = rect.u;
+        rects[slot * 4 + 1] = rect.v;
+        rects[slot * 4 + 2] = rect.width;
+        rects[slot * 4 + 3] = rect.height;
+    }
+    glUniform4fv(shader->getUniformLocation("uvRects"), CardAtlas::kSlots, rects);
+
+    glGenVertexArrays(1, &vertexArray);
+    glGenBuffers(1, &instanceBuffer);
+    GLState::current().bindVertexArray(vertexArray);
+    GLState::current().bindArrayBuffer(instanceBuffer);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(CardInstance), (void*)0);
+    glVertexAttribDivisor(0, 1);
+    glEnableVertexAttribArray(1);
+    glVertexAttribIPointer(1, 1, GL_INT, sizeof(CardInstance), (void*)(2 * sizeof(float)));
+    glVertexAttribDivisor(1, 1);
+    capacity = 0;
+}
+
+void TableWallRenderer::destroy() {
+    if (instanceBuffer) {
+        glDeleteBuffers(1, &instanceBuffer);
+        GLState::current().bufferDeleted(instanceBuffer);
+    }
+    if (vertexArray) glDeleteVertexArrays(1, &vertexArray);
+    GLState::current().invalidate(); // The vertex array and program names may be reused
+    instanceBuffer = vertexArray = 0;
+    shader.reset();
+}
+
+void TableWallRenderer::upload(TableWall& wall) {
+    stats.uploads = 0;
+    stats.uploadBytes = 0;
+    const std::vector<TableWall::Span>& spans = wall.takeDirtySpans();
+    if (spans.empty()) return;
+
+    const std::vector<CardInstance>& instances = wall.getInstances();
+    GLState::current().bindArrayBuffer(instanceBuffer);
+    if (instances.size() != capacity) {
+        // New layout: takeDirtySpans reported everything, so allocate and fill at once
+        capacity = instances.size();
+        glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(CardInstance), instances.data(), GL_DYNAMIC_DRAW);
+        stats.uploads = 1;
+        stats.uploadBytes = capacity * sizeof(CardInstance);
+        return;
+    }
+    for (const TableWall::Span& span : spans) {
+        glBufferSubData(GL_ARRAY_BUFFER, span.first * sizeof(CardInstance), span.count * sizeof(CardInstance),
+                        &instances[span.first]);
+        ++stats.uploads;
+        stats.uploadBytes += span.count * sizeof(CardInstance);
+    }
+}
+
+void TableWallRenderer::draw(const TableWall& wall, GLuint atlasTexture) {
+    stats.drawCalls = 0;
+    if (capacity == 0) return;
+    shader->use();
+    glUniform2f(shader->getUniformLocation("cardSize"), wall.getCardWidth(), wall.getCardHeight());
+    GLState::current().bindTexture(atlasTexture);
+    GLState::current().bindVertexArray(vertexArray);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(capacity));
+    stats.drawCalls = 1;
+}
@@ -0,0 +1,41 @@
+#ifndef TABLE_WALL_RENDERER_H
+#define TABLE_WALL_RENDERER_H
+
+#include <cstddef>
+#include <memory>
+#include <glad/glad.h>
+#include "CardAtlas.h"
+#include "Shader.h"
+#include "TableWall.h"
+
+// Draws every card of a TableWall with one instanced draw. The instance
+// buffer holds the wall's CardInstances as they are; quad corners come
+// from gl_VertexID and each slot's atlas cell from a uniform array, so no
+// vertex or index buffer is involved. upload() sends only the spans the
+// wall reports as changed. Call create() and destroy() with the GL context
+// current.
+class TableWallRenderer {
+public:
+    struct Stats {
+        unsigned int uploads = 0;     // glBufferSubData calls in the last upload()
+        std::size_t uploadBytes = 0;
+        unsigned int drawCalls = 0;   // In the last draw()
+    };
+
+    void create(const CardAtlas& atlas);
+    void destroy();
+
+    void upload(TableWall& wall);
+    void draw(const TableWall& wall, GLuint atlasTexture);
+
+    const Stats& getStats() const { return stats; }
+
+private:
+    std::unique_ptr<Shader> shader;
+    GLuint vertexArray = 0;
+    GLuint instanceBuffer = 0;
+    std::size_t capacity = 0;     // Instances instanceBuffer holds
+    Stats stats;
+};
+
+#endif
@@ -1,115 +1,475 @@
 #include "TextRenderer.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <iostream>
+#include <iterator>
+#include <vector>
+#include "FontAtlasFormat.h"
+#include "GLState.h"
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <stb_image/stb_truetype.h>
 
+namespace {
 
+const char32_t kReplacementCharacter = 0xFFFD;
 
-    TextRenderer:: TextRenderer(const std::string& fontPath, int fontSize) {
-        // Initialize FreeType library
-        FT_Library ft;
-        if (FT_Init_FreeType(&ft)) {
-            std::cerr << "ERROR::FREETYPE: Could not initialize FreeType Library" << std::endl;
+// Code point starting at text[i], advancing i past it. Truncated,
+// overlong or surrogate sequences decode as U+FFFD and consume one byte.
+char32_t DecodeUtf8(std::string_view text, size_t& i) {
+    unsigned char lead = static_cast<unsigned char>(text[i++]);
+    if (lead < 0x80) return lead;
+    int length;
+    char32_t codepoint, minimum;
+    if ((lead & 0xE0) == 0xC0) { length = 1; codepoint = lead & 0x1F; minimum = 0x80; }
+    else if ((lead & 0xF0) == 0xE0) { length = 2; codepoint = lead & 0x0F; minimum = 0x800; }
+    else if ((lead & 0xF8) == 0xF0) { length = 3; codepoint = lead & 0x07; minimum = 0x10000; }
+    else return kReplacementCharacter;
+    if (text.size() - i < static_cast<size_t>(length)) return kReplacementCharacter;
+    for (int k = 0; k < length; ++k) {
+        unsigned char next = static_cast<unsigned char>(text[i + k]);
+        if ((next & 0xC0) != 0x80) return kReplacementCharacter;
+        codepoint = (codepoint << 6) | (next & 0x3F);
+    }
+    if (codepoint < minimum || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF)) {
+        return kReplacementCharacter;
+    }
+    i += length;
+    return codepoint;
+}
+
+}
+
+
+
+    TextRenderer:: TextRenderer(const std::string& fontPath, int fontSize, const std::string& sourceFontPath)
+        : AtlasTexture(0), AtlasSize(0), GlyphScale(1.0f), VAO(0), SourceFontPath(sourceFontPath) {
+        const Character blank = { glm::vec2(0.0f), glm::vec2(0.0f), glm::ivec2(0), glm::ivec2(0), 0, 0 };
+        std::fill(std::begin(Ascii), std::end(Ascii), blank);
+        std::fill(std::begin(Advances), std::end(Advances), 0.0f);
+
+        // The baked atlas is mapped rather than read; only the pages touched
+        // while copying metrics and uploading the atlas are loaded
+        auto start = std::chrono::steady_clock::now();
+        MappedFile file(fontPath);
+        FontAtlasFormat::Header header;
+        if (!file.isOpen() || file.size() < sizeof(header)) {
+            std::cerr << "ERROR::FONT: Failed to load baked font " << fontPath << std::endl;
             return;
         }
-
-        // Load the font
-        FT_Face face;
-        if (FT_New_Face(ft, fontPath.c_str(), 0, &face)) {
-            std::cerr << "ERROR::FREETYPE: Failed to load font" << std::endl;
+        std::memcpy(&header, file.data(), sizeof(header));
+        size_t expected = sizeof(header) + header.glyphCount * sizeof(FontAtlasFormat::Glyph) +
+                          header.kerningCount * sizeof(FontAtlasFormat::Kerning) +
+                          static_cast<size_t>(header.atlasWidth) * header.atlasHeight;
+        if (std::memcmp(header.magic, FontAtlasFormat::kMagic, sizeof(header.magic)) != 0 ||
+            header.version != FontAtlasFormat::kVersion || header.pixelHeight == 0 || file.size() < expected) {
+            std::cerr << "ERROR::FONT: " << fontPath << " is not a version " << FontAtlasFormat::kVersion
+                      << " baked font, run FontBaker" << std::endl;
             return;
         }
 
-        FT_Set_Pixel_Sizes(face, 0, fontSize);
+        const FontAtlasFormat::Glyph* glyphs = reinterpret_cast<const FontAtlasFormat::Glyph*>(file.data() + sizeof(header));
+        const FontAtlasFormat::Kerning* pairs = reinterpret_cast<const FontAtlasFormat::Kerning*>(glyphs + header.glyphCount);
+        const unsigned char* pixels = reinterpret_cast<const unsigned char*>(pairs + header.kerningCount);
+
+        AtlasSize = glm::ivec2(header.atlasWidth, header.atlasHeight);
+        GlyphScale = static_cast<float>(fontSize) / header.pixelHeight;
+        SdfPixelHeight = static_cast<int>(header.pixelHeight);
+        SdfPadding = static_cast<int>(header.padding);
+        SdfOnEdge = static_cast<int>(header.onEdge);
+        int baked = 0;
+        for (std::uint32_t i = 0; i < header.glyphCount; ++i) {
+            const FontAtlasFormat::Glyph& glyph = glyphs[i];
+            if (glyph.codepoint >= 128) continue;
+            glm::ivec2 origin(glyph.x, glyph.y);
+            glm::ivec2 size(glyph.width, glyph.height);
+            Character character = {
+                glm::vec2(origin) / glm::vec2(AtlasSize),
+                glm::vec2(origin + size) / glm::vec2(AtlasSize),
+                size,
+                glm::ivec2(glyph.bearingX, glyph.bearingY),
+                static_cast<GLuint>(glyph.advance * 64.0f + 0.5f),
+                0
+            };
+            Ascii[glyph.codepoint] = character;
+            Advances[glyph.codepoint] = character.Advance / 64.0f;
+            ++baked;
+        }
+        Kerning.assign(128 * 128, 0.0f);
+        for (std::uint32_t i = 0; i < header.kerningCount; ++i) {
+            if (pairs[i].first < 128 && pairs[i].second < 128) Kerning[pairs[i].first * 128 + pairs[i].second] = pairs[i].adjust;
+        }
 
-        // Load characters
         glPixelStorei(GL_UNPACK_ALIGNMENT, 1); // Disable byte-alignment restriction
-        for (unsigned char c = 0; c < 128; c++) {
-            if (FT_Load_Char(face, c, FT_LOAD_RENDER)) {
-                std::cerr << "ERROR::FREETYTPE: Failed to load Glyph" << std::endl;
-                continue;
+        glGenTextures(1, &AtlasTexture);
+        GLState::current().bindTexture(AtlasTexture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, AtlasSize.x, AtlasSize.y, 0, GL_RED, GL_UNSIGNED_BYTE, pixels);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+        LoadMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "SDF glyph atlas: " << baked << " glyphs, " << header.kerningCount << " kerning pairs, "
+                  << AtlasSize.x << "x" << AtlasSize.y << " (" << GetTextureBytes() << " bytes), loaded in "
+                  << LoadMilliseconds << " ms" << std::endl;
+
+        // Streaming ring buffer for every string drawn in a frame
+        glGenVertexArrays(1, &VAO);
+        GLState::current().bindVertexArray(VAO);
+        Stream.create(kStreamVertices * sizeof(TextVertex));
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, sizeof(TextVertex), (void*)0);
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(TextVertex), (void*)(4 * sizeof(float)));
+    }
+
+    TextRenderer:: ~TextRenderer() = default;
+
+    void TextRenderer:: Destroy() {
+        if (AtlasTexture) {
+            glDeleteTextures(1, &AtlasTexture);
+            GLState::current().textureDeleted(AtlasTexture);
+        }
+        for (const GlyphPage& page : GlyphPages) {
+            glDeleteTextures(1, &page.Texture);
+            GLState::current().textureDeleted(page.Texture);
+        }
+        if (VAO) glDeleteVertexArrays(1, &VAO);
+        Stream.destroy();
+        GLState::current().invalidate(); // The vertex array name may be reused
+        AtlasTexture = VAO = 0;
+        AtlasSize = glm::ivec2(0);
+        GlyphPages.clear();
+        Glyphs.clear();
+        Layouts.clear();
+        Commands.clear();
+        LastCommands.clear();
+        LastRanges.clear();
+        LastCount = 0;
+    }
+
+    GlyphCacheStats TextRenderer:: GetGlyphStats() const {
+        GlyphCacheStats stats;
+        stats.rasterized = Rasterized;
+        stats.evictions = Evictions;
+        stats.dropped = Dropped;
+        stats.pages = static_cast<unsigned int>(GlyphPages.size());
+        stats.cached = Glyphs.size();
+        return stats;
+    }
+
+    const TextRenderer::TextLayout& TextRenderer:: GetLayout(std::string_view text, float scale) {
+        // FNV-1a over the text and the scale's bits
+        std::uint64_t key = 0xCBF29CE484222325ULL;
+        for (char c : text) key = (key ^ static_cast<unsigned char>(c)) * 0x100000001B3ULL;
+        std::uint32_t scaleBits;
+        std::memcpy(&scaleBits, &scale, sizeof(scaleBits));
+        key = (key ^ scaleBits) * 0x100000001B3ULL;
+
+        // A colliding string moves on to the next key rather than taking
+        // over the slot, which a command queued this frame may still draw
+        TextLayout* slot = &Layouts[key];
+        while (slot->Version != 0 && (slot->Scale != scale || slot->Text != text)) slot = &Layouts[++key];
+        TextLayout& layout = *slot;
+        layout.LastUsed = Frame;
+        if (layout.Version != 0 && layout.Scale == scale && layout.Text == text &&
+            layout.Dropped == 0 && (layout.PageMask <= 1 || layout.Evictions == Evictions)) {
+            // Keep the pages this layout samples from being recycled this frame
+            for (int page = 1; layout.PageMask >> page; ++page) {
+                if (layout.PageMask & (1u << page)) TouchPage(page);
             }
+            return layout;
+        }
 
-            GLuint texture;
-            glGenTextures(1, &texture);
-            glBindTexture(GL_TEXTURE_2D, texture);
-            glTexImage2D(
-                GL_TEXTURE_2D,
-                0,
-                GL_RED,
-                face->glyph->bitmap.width,
-                face->glyph->bitmap.rows,
-                0,
-                GL_RED,
-                GL_UNSIGNED_BYTE,
-                face->glyph->bitmap.buffer
-            );
+        // New string, one whose glyph pages were recycled since it was built,
+        // or one that found every page busy and may find room now
+        layout.Text.assign(text.data(), text.size());
+        layout.Scale = scale;
+        layout.Version = NextLayoutVersion++;
+        layout.Quads.clear();
+        layout.QuadPages.clear();
+        ++LayoutsBuilt;
 
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        const float layoutScale = scale * GlyphScale;
+        float x = 0.0f;
+        char32_t previous = 0;
+        unsigned int pageMask = 0;
+        const unsigned int dropped = Dropped;
+        for (size_t i = 0; i < text.size();) {
+            char32_t c = DecodeUtf8(text, i);
+            Character ch = c < 128 ? Ascii[c] : FindGlyph(c);
+            if (previous != 0 && previous < 128 && c < 128) x += Kerning[previous * 128 + c] * layoutScale;
+            previous = c;
 
-            Character character = {
-                texture,
-                glm::ivec2(face->glyph->bitmap.width, face->glyph->bitmap.rows),
-                glm::ivec2(face->glyph->bitmap_left, face->glyph->bitmap_top),
-                static_cast<GLuint>(face->glyph->advance.x)
+            float xpos = x + ch.Bearing.x * layoutScale;
+            float ypos = -(ch.Size.y - ch.Bearing.y) * layoutScale;
+
+            float w = ch.Size.x * layoutScale;
+            float h = ch.Size.y * layoutScale;
+
+            TextVertex vertices[6] = {
+                { xpos,     ypos + h,   ch.UVMin.x, ch.UVMin.y, 0.0f, 0.0f, 0.0f },
+                { xpos,     ypos,       ch.UVMin.x, ch.UVMax.y, 0.0f, 0.0f, 0.0f },
+                { xpos + w, ypos,       ch.UVMax.x, ch.UVMax.y, 0.0f, 0.0f, 0.0f },
+
+                { xpos,     ypos + h,   ch.UVMin.x, ch.UVMin.y, 0.0f, 0.0f, 0.0f },
+                { xpos + w, ypos,       ch.UVMax.x, ch.UVMax.y, 0.0f, 0.0f, 0.0f },
+                { xpos + w, ypos + h,   ch.UVMax.x, ch.UVMin.y, 0.0f, 0.0f, 0.0f }
             };
-            Characters.insert(std::pair<char, Character>(c, character));
+            layout.Quads.insert(layout.Quads.end(), vertices, vertices + 6);
+            layout.QuadPages.push_back(static_cast<std::uint8_t>(ch.Page));
+            pageMask |= 1u << ch.Page;
+
+            x += ch.Advance / 64.0f * layoutScale; // Advance is in 1/64 pixel
         }
+        layout.PageMask = pageMask;
+        layout.Evictions = Evictions;
+        layout.Dropped = Dropped - dropped;
+        return layout;
+    }
 
-        FT_Done_Face(face);
-        FT_Done_FreeType(ft);
+    Character TextRenderer:: FindGlyph(char32_t codepoint) {
+        auto found = Glyphs.find(codepoint);
+        const Character* glyph = found != Glyphs.end() ? &found->second : Rasterize(codepoint);
+        if (!glyph || glyph->Page < 0) return Ascii[static_cast<unsigned char>('?')];
+        TouchPage(glyph->Page);
+        return *glyph;
+    }
 
-        // Configure VAO/VBO for text quads
-        glGenVertexArrays(1, &VAO);
-        glGenBuffers(1, &VBO);
-        glBindVertexArray(VAO);
-        glBindBuffer(GL_ARRAY_BUFFER, VBO);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 6 * 4, NULL, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(0);
-        glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), 0);
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-        glBindVertexArray(0);
+    void TextRenderer:: TouchPage(int page) {
+        if (page > 0) GlyphPages[page - 1].LastUsed = Frame;
     }
 
-    void TextRenderer:: RenderText(Shader& shader, std::string text, float x, float y, float scale, glm::vec3 color) {
-        shader.use();
+    const Character* TextRenderer:: Rasterize(char32_t codepoint) {
+        if (!SourceFontInfo && !SourceFontFailed) {
+            // Mapped on the first glyph the baked atlas lacks, so ASCII-only
+            // text never touches the source font
+            std::unique_ptr<stbtt_fontinfo> info(new stbtt_fontinfo);
+            if (SourceFontPath.empty() || !SourceFont.open(SourceFontPath) ||
+                !stbtt_InitFont(info.get(), SourceFont.data(), stbtt_GetFontOffsetForIndex(SourceFont.data(), 0))) {
+                std::cerr << "ERROR::FONT: Failed to load source font '" << SourceFontPath
+                          << "', text outside the baked atlas will show as '?'" << std::endl;
+                SourceFontFailed = true;
+            }
+            else {
+                SourceScale = stbtt_ScaleForPixelHeight(info.get(), static_cast<float>(SdfPixelHeight));
+                SourceFontInfo = std::move(info);
+            }
+        }
 
-        glm::mat4 projection = glm::ortho(0.0f, static_cast<float>(1280), 0.0f, static_cast<float>(960));
-        glUniformMatrix4fv(glGetUniformLocation(shader.getID(), "projection"), 1, GL_FALSE, glm::value_ptr(projection));
+        int glyphIndex = SourceFontInfo ? stbtt_FindGlyphIndex(SourceFontInfo.get(), static_cast<int>(codepoint)) : 0;
+        if (glyphIndex == 0) {
+            // Remember the miss so the font is searched once per code point
+            Character& missing = Glyphs[codepoint];
+            missing = Ascii[static_cast<unsigned char>('?')];
+            missing.Page = -1;
+            return &missing;
+        }
 
-        glUniform3f(glGetUniformLocation(shader.getID(), "textColor"), color.x, color.y, color.z);
-        glActiveTexture(GL_TEXTURE0);
-        glBindVertexArray(VAO);
+        // Same distance field parameters as the baked atlas, so one shader draws both
+        int width = 0, height = 0, xoff = 0, yoff = 0;
+        unsigned char* sdf = stbtt_GetGlyphSDF(SourceFontInfo.get(), SourceScale, glyphIndex, SdfPadding,
+                                               static_cast<unsigned char>(SdfOnEdge),
+                                               static_cast<float>(SdfOnEdge) / SdfPadding,
+                                               &width, &height, &xoff, &yoff);
+        int page = 0, x = 0, y = 0;
+        if (sdf) {
+            page = AllocateGlyph(width, height, x, y);
+            if (page == 0) {
+                // Every page is in use this frame; try again next time the text is laid out
+                stbtt_FreeSDF(sdf, nullptr);
+                ++Dropped;
+                return nullptr;
+            }
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            GLState::current().bindTexture(PageTexture(page));
+            glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, GL_RED, GL_UNSIGNED_BYTE, sdf);
+            stbtt_FreeSDF(sdf, nullptr);
+        }
+        else {
+            width = height = xoff = yoff = 0; // Blank glyph such as a no-break space
+        }
 
-        for (char c : text) {
-            Character ch = Characters[c];
+        int advance, leftSideBearing;
+        stbtt_GetGlyphHMetrics(SourceFontInfo.get(), glyphIndex, &advance, &leftSideBearing);
+        glm::ivec2 origin(x, y);
+        glm::ivec2 size(width, height);
+        Character& character = Glyphs[codepoint];
+        character = {
+            glm::vec2(origin) / static_cast<float>(kGlyphPageSize),
+            glm::vec2(origin + size) / static_cast<float>(kGlyphPageSize),
+            size,
+            glm::ivec2(xoff, -yoff),
+            static_cast<GLuint>(advance * SourceScale * 64.0f + 0.5f),
+            page
+        };
+        ++Rasterized;
+        return &character;
+    }
+
+    int TextRenderer:: AllocateGlyph(int width, int height, int& x, int& y) {
+        if (width > kGlyphPageSize || height > kGlyphPageSize) return 0;
+
+        // Shelf packing: fill the current row left to right, then open a new one below
+        auto place = [&](GlyphPage& page) {
+            int penX = page.PenX, penY = page.PenY, shelfHeight = page.ShelfHeight;
+            if (penX + width > kGlyphPageSize) {
+                penX = 0;
+                penY += shelfHeight;
+                shelfHeight = 0;
+            }
+            if (penY + height > kGlyphPageSize) return false;
+            x = penX;
+            y = penY;
+            page.PenX = penX + width;
+            page.PenY = penY;
+            page.ShelfHeight = std::max(shelfHeight, height);
+            return true;
+        };
+        for (size_t i = 0; i < GlyphPages.size(); ++i) {
+            if (place(GlyphPages[i])) return static_cast<int>(i) + 1;
+        }
 
-            float xpos = x + ch.Bearing.x * scale;
-            float ypos = y - (ch.Size.y - ch.Bearing.y) * scale;
+        int page = 0;
+        if (GlyphPages.size() < static_cast<size_t>(kMaxGlyphPages)) {
+            GlyphPage created;
+            glGenTextures(1, &created.Texture);
+            GLState::current().bindTexture(created.Texture);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            GlyphPages.push_back(created);
+            page = static_cast<int>(GlyphPages.size());
+        }
+        else {
+            // Recycle the least recently used page, but never one this frame draws from
+            for (size_t i = 0; i < GlyphPages.size(); ++i) {
+                if (GlyphPages[i].LastUsed == Frame) continue;
+                if (page == 0 || GlyphPages[i].LastUsed < GlyphPages[page - 1].LastUsed) page = static_cast<int>(i) + 1;
+            }
+            if (page == 0) return 0;
+            for (auto it = Glyphs.begin(); it != Glyphs.end();) {
+                it = it->second.Page == page ? Glyphs.erase(it) : std::next(it);
+            }
+            GlyphPages[page - 1].PenX = GlyphPages[page - 1].PenY = GlyphPages[page - 1].ShelfHeight = 0;
+            ++Evictions;
+            GLState::current().bindTexture(GlyphPages[page - 1].Texture);
+        }
+        // Start from zero distance everywhere so filtering at glyph edges never
+        // picks up whatever the page held before
+        std::vector<unsigned char> clear(static_cast<size_t>(kGlyphPageSize) * kGlyphPageSize, 0);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, kGlyphPageSize, kGlyphPageSize, 0, GL_RED, GL_UNSIGNED_BYTE, clear.data());
+        place(GlyphPages[page - 1]);
+        return page;
+    }
 
-            float w = ch.Size.x * scale;
-            float h = ch.Size.y * scale;
+    float TextRenderer:: MeasureText(std::string_view text, float scale) {
+        // Same accumulation as GetLayout, so the result matches the drawn pen position exactly
+        const float layoutScale = scale * GlyphScale;
+        float x = 0.0f;
+        char32_t previous = 0;
+        for (size_t i = 0; i < text.size();) {
+            char32_t c = DecodeUtf8(text, i);
+            if (c < 128) {
+                if (previous != 0 && previous < 128) x += Kerning[previous * 128 + c] * layoutScale;
+                x += Advances[c] * layoutScale;
+            }
+            else {
+                x += FindGlyph(c).Advance / 64.0f * layoutScale;
+            }
+            previous = c;
+        }
+        return x;
+    }
 
-            float vertices[6][4] = {
-                { xpos,     ypos + h,   0.0f, 0.0f },
-                { xpos,     ypos,       0.0f, 1.0f },
-                { xpos + w, ypos,       1.0f, 1.0f },
+    void TextRenderer:: RenderText(std::string_view text, float x, float y, float scale, glm::vec3 color) {
+        const TextLayout& layout = GetLayout(text, scale);
+        Commands.push_back({ &layout, layout.Version, x, y, color });
+    }
 
-                { xpos,     ypos + h,   0.0f, 0.0f },
-                { xpos + w, ypos,       1.0f, 1.0f },
-                { xpos + w, ypos + h,   1.0f, 0.0f }
-            };
+    void TextRenderer:: Flush(Shader& shader) {
+        FrameStats = TextFrameStats();
+        FrameStats.strings = static_cast<unsigned int>(Commands.size());
+        FrameStats.layoutsBuilt = LayoutsBuilt;
+        LayoutsBuilt = 0;
+        for (const TextCommand& command : Commands) {
+            FrameStats.glyphs += static_cast<unsigned int>(command.Layout->Quads.size() / 6);
+        }
 
-            glBindTexture(GL_TEXTURE_2D, ch.TextureID);
-            glBindBuffer(GL_ARRAY_BUFFER, VBO);
-            glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
-            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        if (Commands.empty() || Commands != LastCommands || LastCount == 0) {
+            // Vertices are grouped by glyph page so each page is one draw
+            unsigned int pageMask = 0;
+            for (const TextCommand& command : Commands) pageMask |= command.Layout->PageMask;
+            GLsizei pageStarts[kMaxGlyphPages + 1] = {};
+            GLsizei pageCounts[kMaxGlyphPages + 1] = {};
+            Pending.resize(FrameStats.glyphs * 6);
+            if (pageMask <= 1) {
+                TextVertex* out = Pending.data();
+                for (const TextCommand& command : Commands) {
+                    for (const TextVertex& quad : command.Layout->Quads) {
+                        *out++ = { quad.x + command.X, quad.y + command.Y, quad.u, quad.v,
+                                   command.Color.x, command.Color.y, command.Color.z };
+                    }
+                }
+                pageCounts[0] = static_cast<GLsizei>(Pending.size());
+            }
+            else {
+                for (const TextCommand& command : Commands) {
+                    for (std::uint8_t page : command.Layout->QuadPages) pageCounts[page] += 6;
+                }
+                TextVertex* out[kMaxGlyphPages + 1];
+                for (int page = 0, start = 0; page <= kMaxGlyphPages; start += pageCounts[page++]) {
+                    pageStarts[page] = start;
+                    out[page] = Pending.data() + start;
+                }
+                for (const TextCommand& command : Commands) {
+                    const TextVertex* quad = command.Layout->Quads.data();
+                    for (std::uint8_t page : command.Layout->QuadPages) {
+                        TextVertex* target = out[page];
+                        for (int corner = 0; corner < 6; ++corner, ++quad) {
+                            *target++ = { quad->x + command.X, quad->y + command.Y, quad->u, quad->v,
+                                          command.Color.x, command.Color.y, command.Color.z };
+                        }
+                        out[page] = target;
+                    }
+                }
+            }
+            LastCount = 0;
+            LastRanges.clear();
+            if (!Pending.empty()) {
+                GLsizeiptr bytes = static_cast<GLsizeiptr>(Pending.size() * sizeof(TextVertex));
+                void* target = Stream.map(bytes);
+                if (target) {
+                    std::memcpy(target, Pending.data(), bytes);
+                    GLint first = Stream.unmap(sizeof(TextVertex));
+                    FrameStats.uploadBytes = static_cast<size_t>(bytes);
+                    for (int page = 0; page <= kMaxGlyphPages; ++page) {
+                        if (pageCounts[page] > 0) LastRanges.push_back({ page, first + pageStarts[page], pageCounts[page] });
+                    }
+                    LastCount = static_cast<GLsizei>(Pending.size());
+                }
+            }
+        }
+        LastCommands.swap(Commands);
+        Commands.clear();
 
-            glDrawArrays(GL_TRIANGLES, 0, 6);
+        if (Layouts.size() > kMaxLayouts) {
+            // Keep only what this frame drew; the commands just saved point at those
+            for (auto it = Layouts.begin(); it != Layouts.end();) {
+                it = it->second.LastUsed == Frame ? std::next(it) : Layouts.erase(it);
+            }
+        }
+        ++Frame;
+        if (LastCount == 0) return;
 
-            x += (ch.Advance >> 6) * scale; // Bitshift by 6 to get value in pixels
+        shader.use(); // Its projection comes from the FrameData uniform block
+        GLState::current().bindVertexArray(VAO);
+        for (const DrawRange& range : LastRanges) {
+            GLState::current().bindTexture(PageTexture(range.Page));
+            glDrawArrays(GL_TRIANGLES, range.First, range.Count);
         }
-        glBindVertexArray(0);
-        glBindTexture(GL_TEXTURE_2D, 0);
-    }
\ No newline at end of file
+        FrameStats.drawCalls = static_cast<unsigned int>(LastRanges.size());
+    }
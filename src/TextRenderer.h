@@ -1,21 +1,171 @@
 #include "Game.h"
-#include <ft2build.h>
-#include FT_FREETYPE_H
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "MappedFile.h"
+#include "StreamBuffer.h"
+
+struct stbtt_fontinfo;
 
 struct Character {
-    GLuint TextureID;   // ID handle of the glyph texture
+    glm::vec2 UVMin;    // Top-left of the glyph in the atlas
+    glm::vec2 UVMax;    // Bottom-right of the glyph in the atlas
     glm::ivec2 Size;    // Size of glyph
     glm::ivec2 Bearing; // Offset from baseline to left/top of glyph
-    GLuint Advance;     // Horizontal offset to advance to next glyph
+    GLuint Advance;     // Horizontal offset to advance to next glyph, 1/64 pixel
+    int Page;           // Texture holding the glyph: 0 is the baked atlas, -1 if the font has none
+};
+
+// One corner of a glyph quad in the frame's text stream
+struct TextVertex {
+    float x, y;    // Screen position in pixels
+    float u, v;    // Atlas coordinates
+    float r, g, b; // Text color
+};
+
+// What the last Flush sent to GL
+struct TextFrameStats {
+    unsigned int strings = 0;
+    unsigned int glyphs = 0;
+    unsigned int layoutsBuilt = 0; // Strings laid out from scratch rather than taken from the cache
+    size_t uploadBytes = 0;        // 0 when the frame's text matched the previous frame
+    unsigned int drawCalls = 0;    // One per glyph page the frame's text touches
 };
 
+// Glyphs rasterized on demand outside the baked atlas
+struct GlyphCacheStats {
+    unsigned int rasterized = 0;    // Since construction
+    unsigned int evictions = 0;     // Pages recycled because all of them were full
+    unsigned int dropped = 0;       // Glyphs that found no room and were drawn as '?'
+    unsigned int pages = 0;         // On-demand pages allocated
+    size_t cached = 0;              // Non-ASCII glyphs currently resident
+};
+
+// Glyphs come from an atlas of signed distance fields baked offline (see
+// FontAtlasFormat.h), so text at any scale stays sharp when drawn with a
+// shader that thresholds the distance.
+// Text is UTF-8. ASCII comes from the baked atlas; any other code point is
+// rasterized from the source font the first time it is drawn, into one of a
+// few on-demand atlas pages that are recycled least recently used first.
+// RenderText only queues a string; Flush draws every string queued since
+// the previous Flush with one buffer upload and one draw call per glyph
+// page in use, which is a single draw for ASCII-only text. Each
+// (string, scale) is laid out once and cached, and a frame whose text is
+// identical to the last one redraws the previous upload without rebuilding
+// or sending any vertices.
 class TextRenderer {
 
 public:
-    std::map<char, Character> Characters;
-    GLuint VAO, VBO;
+    static const int kGlyphPageSize = 256;   // Texels per side of an on-demand page
+    static const int kMaxGlyphPages = 4;     // On-demand pages before the oldest is recycled
+
+    Character Ascii[128];  // From the baked atlas, indexed by code point
+    float Advances[128];   // Ascii[c].Advance in pixels at the baked size, packed for MeasureText
+    GLuint AtlasTexture;   // Every glyph, one byte of distance per texel
+    glm::ivec2 AtlasSize;
+    float GlyphScale;      // Requested font size over the size the atlas was baked at
+    std::vector<float> Kerning; // [first * 128 + second], pixels at the baked size
+    double LoadMilliseconds = 0.0;   // Time the constructor spent loading the font
+    GLuint VAO;
+
+    // `fontPath` is a glyph atlas written by tools/FontBaker. Code points it
+    // lacks are rasterized from `sourceFontPath`, mapped on first use.
+    TextRenderer(const std::string& fontPath, int fontSize, const std::string& sourceFontPath = "");
+    ~TextRenderer();
+    // Releases every GL object; call with the context current, before the destructor
+    void Destroy();
+
+    bool IsLoaded() const { return AtlasSize.x > 0; }
+    size_t GetTextureBytes() const {
+        return static_cast<size_t>(AtlasSize.x) * AtlasSize.y +
+               static_cast<size_t>(GlyphPages.size()) * kGlyphPageSize * kGlyphPageSize;
+    }
+    const TextFrameStats& GetFrameStats() const { return FrameStats; }
+    GlyphCacheStats GetGlyphStats() const;
+
+    // Pen advance of `text` drawn at `scale`, kerning included: exactly how
+    // far RenderText moves the pen. Costs a table lookup or two per glyph.
+    float MeasureText(std::string_view text, float scale);
+    void RenderText(std::string_view text, float x, float y, float scale, glm::vec3 color);
+    // `shader` reads its projection from the FrameData block (FrameUniforms.h)
+    void Flush(Shader& shader);
+
+private:
+    static const int kStreamVertices = 6 * 4096; // Ring size; the buffer grows if one frame needs more
+    static const size_t kMaxLayouts = 256;       // Beyond this, layouts unused last frame are dropped
+
+    // Glyph quads of one string at one scale, relative to the pen origin
+    struct TextLayout {
+        std::string Text;
+        float Scale = 0.0f;
+        unsigned int Version = 0;        // Unique per build, so stale commands never match
+        unsigned long long LastUsed = 0; // Frame number
+        unsigned int PageMask = 0;       // Bit per glyph page the quads sample
+        unsigned int Evictions = 0;      // Page evictions when built; later ones may have invalidated it
+        unsigned int Dropped = 0;        // Glyphs laid out as '?' for want of a page; rebuilt on next use
+        std::vector<TextVertex> Quads;
+        std::vector<std::uint8_t> QuadPages; // Glyph page of each quad
+    };
+
+    // An on-demand glyph texture, filled shelf by shelf
+    struct GlyphPage {
+        GLuint Texture = 0;
+        int PenX = 0, PenY = 0, ShelfHeight = 0;
+        unsigned long long LastUsed = 0; // Frame number
+    };
+
+    // A run of the frame's vertices that share a page
+    struct DrawRange {
+        int Page;
+        GLint First;
+        GLsizei Count;
+    };
+
+    // One queued RenderText call
+    struct TextCommand {
+        const TextLayout* Layout;
+        unsigned int Version;
+        float X, Y;
+        glm::vec3 Color;
+
+        bool operator==(const TextCommand& other) const {
+            return Layout == other.Layout && Version == other.Version && X == other.X && Y == other.Y &&
+                   Color == other.Color;
+        }
+    };
+
+    const TextLayout& GetLayout(std::string_view text, float scale);
+    Character FindGlyph(char32_t codepoint);   // Marks the glyph's page used this frame
+    const Character* Rasterize(char32_t codepoint);
+    int AllocateGlyph(int width, int height, int& x, int& y);
+    void TouchPage(int page);
+    GLuint PageTexture(int page) const { return page == 0 ? AtlasTexture : GlyphPages[page - 1].Texture; }
 
-    TextRenderer(const std::string& fontPath, int fontSize);
+    std::unordered_map<std::uint64_t, TextLayout> Layouts; // Keyed by a hash of (text, scale), next key on collision
+    unsigned int NextLayoutVersion = 1;
+    unsigned int LayoutsBuilt = 0;    // Since the last Flush
+    unsigned long long Frame = 0;
+    std::vector<TextCommand> Commands;     // Queued since the last Flush
+    std::vector<TextCommand> LastCommands; // What the previous Flush drew
+    std::vector<TextVertex> Pending;       // Vertex scratch for the upload
+    std::vector<DrawRange> LastRanges;     // Previous Flush's vertices in Stream
+    GLsizei LastCount = 0;
+    StreamBuffer Stream;
+    TextFrameStats FrameStats;
 
-    void RenderText(Shader& shader, std::string text, float x, float y, float scale, glm::vec3 color);
+    std::unordered_map<char32_t, Character> Glyphs; // Non-ASCII code points seen so far
+    std::vector<GlyphPage> GlyphPages;              // Page n is GlyphPages[n - 1]
+    std::string SourceFontPath;
+    MappedFile SourceFont;
+    std::unique_ptr<stbtt_fontinfo> SourceFontInfo; // Null until the first miss, or if it failed to load
+    bool SourceFontFailed = false;
+    float SourceScale = 0.0f;
+    int SdfPixelHeight = 0;          // Distance field parameters of the baked atlas
+    int SdfPadding = 0;
+    int SdfOnEdge = 0;
+    unsigned int Evictions = 0;
+    unsigned int Rasterized = 0;
+    unsigned int Dropped = 0;
 };
\ No newline at end of file
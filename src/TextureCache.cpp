@@ -0,0 +1,103 @@
+#include "TextureCache.h"
+#include <iostream>
+#include "GLState.h"
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image/stb_image.h>
+
+TextureCache::Handle TextureCache::acquire(const std::string& path) {
+    auto found = byPath.find(path);
+    if (found != byPath.end()) {
+        ++entries[slotOf(found->second)].refCount;
+        return found->second;
+    }
+
+    int width, height, nrChannels;
+    ++decodes;
+    unsigned char* data = stbi_load(path.c_str(), &width, &height, &nrChannels, 0);
+    if (!data) {
+        std::cerr << "Failed to load texture: " << path << std::endl;
+        return kInvalidHandle;
+    }
+
+    Entry entry;
+    glGenTextures(1, &entry.texture);
+    GLState::current().bindTexture(entry.texture);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    GLenum format = (nrChannels == 4) ? GL_RGBA : GL_RGB;
+    // One level only: GL_LINEAR never samples mips, and the atlas padding
+    // would not keep smaller levels from bleeding between cards
+    glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
+    stbi_image_free(data);
+
+    entry.refCount = 1;
+    entry.bytes = static_cast<size_t>(width) * height * (nrChannels == 4 ? 4 : 3);
+    entry.path = path;
+
+    int slot;
+    if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+        entries[slot] = std::move(entry);
+    }
+    else {
+        slot = static_cast<int>(entries.size());
+        entries.push_back(std::move(entry));
+        generations.push_back(0);
+    }
+    Handle handle = handleOf(slot);
+    byPath[path] = handle;
+    ++liveTextures;
+    liveBytes += entries[slot].bytes;
+    return handle;
+}
+
+void TextureCache::release(Handle handle) {
+    if (!valid(handle)) return;
+    int slot = slotOf(handle);
+    Entry& entry = entries[slot];
+    if (--entry.refCount > 0) return;
+    byPath.erase(entry.path);
+    destroy(slot);
+    freeSlots.push_back(slot);
+}
+
+GLuint TextureCache::get(Handle handle) const {
+    return valid(handle) ? entries[slotOf(handle)].texture : 0;
+}
+
+int TextureCache::getRefCount(Handle handle) const {
+    return valid(handle) ? entries[slotOf(handle)].refCount : 0;
+}
+
+void TextureCache::clear() {
+    // Slots and their generations stay, so handles from before the clear
+    // never match a texture acquired after it
+    freeSlots.clear();
+    for (int slot = static_cast<int>(entries.size()) - 1; slot >= 0; --slot) {
+        if (entries[slot].refCount > 0) destroy(slot);
+        freeSlots.push_back(slot);
+    }
+    byPath.clear();
+}
+
+bool TextureCache::valid(Handle handle) const {
+    if (handle < 0) return false;
+    int slot = slotOf(handle);
+    return slot < static_cast<int>(entries.size()) && entries[slot].refCount > 0 &&
+           static_cast<unsigned>(handle >> kSlotBits) == generations[slot];
+}
+
+void TextureCache::destroy(int slot) {
+    Entry& entry = entries[slot];
+    glDeleteTextures(1, &entry.texture);
+    GLState::current().textureDeleted(entry.texture);
+    --liveTextures;
+    liveBytes -= entry.bytes;
+    entry = Entry();
+    generations[slot] = (generations[slot] + 1) & kGenerationMask;
+}
@@ -0,0 +1,62 @@
+#ifndef TEXTURE_CACHE_H
+#define TEXTURE_CACHE_H
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <glad/glad.h>
+
+// Path-keyed, reference-counted cache of GL textures. Each image file is
+// decoded and uploaded once however many times it is acquired; the texture
+// is deleted when the last reference is released. Callers hold small
+// integer handles rather than GL names. A handle carries its slot's
+// generation, so one kept past its final release stays invalid even after
+// the slot is reused. Call clear() while the GL context is still current;
+// the destructor does not touch GL.
+class TextureCache {
+public:
+    typedef int Handle;
+    static const Handle kInvalidHandle = -1;
+
+    // Returns the cached texture for `path`, loading it on first use.
+    // Returns kInvalidHandle if the file cannot be decoded.
+    Handle acquire(const std::string& path);
+    void release(Handle handle);
+
+    GLuint get(Handle handle) const; // 0 for an invalid or released handle
+    int getRefCount(Handle handle) const;
+
+    int getLiveTextures() const { return liveTextures; }
+    size_t getLiveBytes() const { return liveBytes; }
+    unsigned long long getDecodes() const { return decodes; } // Files read since construction
+
+    void clear(); // Deletes every texture; outstanding handles become invalid
+
+private:
+    struct Entry {
+        GLuint texture = 0;
+        int refCount = 0;
+        size_t bytes = 0;
+        std::string path;
+    };
+
+    // Handle = generation << kSlotBits | slot
+    static const int kSlotBits = 16;
+    static const unsigned kGenerationMask = 0x7FFF; // Keeps handles non-negative
+
+    static int slotOf(Handle handle) { return handle & ((1 << kSlotBits) - 1); }
+    Handle handleOf(int slot) const { return static_cast<Handle>(generations[slot] << kSlotBits) | slot; }
+    bool valid(Handle handle) const;
+    void destroy(int slot);
+
+    std::vector<Entry> entries;                    // Indexed by slot
+    std::vector<unsigned> generations;             // Per slot, bumped each time its texture is deleted
+    std::vector<int> freeSlots;                    // Released slots for reuse
+    std::unordered_map<std::string, Handle> byPath;
+    int liveTextures = 0;
+    size_t liveBytes = 0;
+    unsigned long long decodes = 0;
+};
+
+#endif
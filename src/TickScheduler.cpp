@@ -0,0 +1,28 @@
+#include "TickScheduler.h"
+#include <algorithm>
+
+TickScheduler::TickScheduler(double tickRate) : step(1.0 / std::max(tickRate, 1e-6)) {}
+
+int TickScheduler::advance(double now) {
+    if (!started) {
+        started = true;
+        last = now;
+        return 0;
+    }
+    accumulator += std::max(0.0, now - last); // A clock that steps back adds nothing
+    last = now;
+
+    int due = 0;
+    while (accumulator >= step && due < kMaxTicksPerAdvance) {
+        accumulator -= step;
+        ++due;
+    }
+    if (accumulator >= step) {
+        // Too far behind to catch up: keep the fraction, drop whole ticks
+        double whole = static_cast<double>(static_cast<long long>(accumulator / step)) * step;
+        dropped += whole;
+        accumulator -= whole;
+    }
+    ticks += due;
+    return due;
+}
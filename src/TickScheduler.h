@@ -0,0 +1,36 @@
+#ifndef TICK_SCHEDULER_H
+#define TICK_SCHEDULER_H
+
+// Fixed-timestep clock for game logic. Each frame passes the current time
+// to advance(), which returns how many ticks of 1 / tickRate seconds have
+// come due; the caller runs its logic that many times. The time left over
+// stays in an accumulator, and getAlpha() reports it as a fraction of a
+// tick, so visuals can interpolate between the last two logic states. Game
+// speed then follows the tick rate whatever the frame rate.
+//
+// Time is passed in rather than read, so any clock can drive it; the game
+// uses glfwGetTime(), TickSchedulerBench a synthetic one.
+class TickScheduler {
+public:
+    static const int kMaxTicksPerAdvance = 8; // Longer stalls are dropped rather than replayed
+
+    explicit TickScheduler(double tickRate);
+
+    // Ticks due at `now`, in seconds. The first call only starts the clock.
+    int advance(double now);
+
+    double getAlpha() const { return accumulator / step; } // [0, 1): progress towards the next tick
+    double getStep() const { return step; }
+    unsigned long long getTicks() const { return ticks; }  // Ticks returned so far
+    double getDroppedTime() const { return dropped; }      // Seconds lost to kMaxTicksPerAdvance
+
+private:
+    double step;
+    double accumulator = 0.0;
+    double last = 0.0;
+    bool started = false;
+    unsigned long long ticks = 0;
+    double dropped = 0.0;
+};
+
+#endif
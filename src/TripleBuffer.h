@@ -0,0 +1,50 @@
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <atomic>
+
+// Lock-free single-producer, single-consumer triple buffer. The writer
+// fills back() and publish()es it; the reader acquire()s the newest
+// published value and reads front() until its next acquire. Neither side
+// ever waits for the other: the writer always has a free slot, and values
+// the reader had no time for are overwritten, not queued.
+//
+// The three slots rotate through one atomic index, the middle slot, whose
+// fresh bit says whether it holds a value the reader has not taken yet.
+// Its accesses are sequentially consistent, so a caller can pair them with
+// a flag of its own to sleep without missing a publish (see FrameChannel).
+template <typename T>
+class TripleBuffer {
+public:
+    // Writer side
+    T& back() { return slots[writer.index]; }
+    void publish() {
+        writer.index = middle.exchange(writer.index | kFresh) & kIndexMask;
+    }
+
+    // Reader side. True if a newer value was taken; front() keeps the
+    // previous one otherwise.
+    bool acquire() {
+        if (!hasFresh()) return false;
+        reader.index = middle.exchange(reader.index) & kIndexMask;
+        return true;
+    }
+    const T& front() const { return slots[reader.index]; }
+
+    bool hasFresh() const { return (middle.load() & kFresh) != 0; }
+
+private:
+    static const unsigned kIndexMask = 3;
+    static const unsigned kFresh = 4;
+
+    struct alignas(64) Side {
+        unsigned index;
+    };
+
+    T slots[3] = {};
+    Side writer = { 0 };
+    Side reader = { 1 };
+    alignas(64) std::atomic<unsigned> middle{ 2 };
+};
+
+#endif
@@ -0,0 +1,112 @@
+#include "BlackjackEngine.h"
+
+template <typename Rng>
+BasicBlackjackEngine<Rng>::BasicBlackjackEngine(const Rng& generator, int decks, double penetration)
+    : shoe(decks, penetration), state(RoundState::PlayerTurn), result(RoundResult::None), playerStood(false), rng(generator), roundNumber(0), deckResets(0), discardShuffles(0) {
+    shoe.shuffle(rng);
+}
+
+template <typename Rng>
+void BasicBlackjackEngine<Rng>::resetDeck() {
+    shoe.shuffle(rng);
+    ++deckResets;
+    startRound();
+}
+
+template <typename Rng>
+void BasicBlackjackEngine<Rng>::startRound() {
+    if (shoe.needsShuffle()) {
+        resetDeck();
+        return;
+    }
+    state = RoundState::PlayerTurn;
+    result = RoundResult::None;
+    playerStood = false;
+    ++roundNumber;
+    dealInitialCards();
+}
+
+template <typename Rng>
+void BasicBlackjackEngine<Rng>::dealInitialCards() {
+    playerHand.clear();
+    dealerHand.clear();
+    dealCard(playerHand);
+    dealCard(dealerHand);
+    dealCard(playerHand);
+    dealCard(dealerHand);
+}
+
+// Returns false when every card of the shoe is already in play and a fresh
+// round was dealt instead.
+template <typename Rng>
+bool BasicBlackjackEngine<Rng>::dealCard(Hand& hand) {
+    if (shoe.empty()) {
+        // Like a dealer out of cards mid-round: shuffle the discards and play
+        // on, so rounds that need many cards are neither lost nor replaced
+        int inPlay = playerHand.size() + dealerHand.size();
+        if (inPlay >= shoe.size()) {
+            resetDeck();
+            return false;
+        }
+        shoe.reshuffleDiscards(rng, inPlay);
+        ++discardShuffles;
+    }
+    hand.add(shoe.deal());
+    return true;
+}
+
+template <typename Rng>
+void BasicBlackjackEngine<Rng>::hit() {
+    if (state != RoundState::PlayerTurn) return;
+    if (!dealCard(playerHand)) return;
+
+    // Reaching 21 or busting ends the round without the dealer drawing
+    if (playerHand.getScore() >= 21) {
+        settle();
+    }
+}
+
+template <typename Rng>
+void BasicBlackjackEngine<Rng>::stand() {
+    if (state != RoundState::PlayerTurn) return;
+    playerStood = true;
+    state = RoundState::DealerTurn;
+}
+
+template <typename Rng>
+bool BasicBlackjackEngine<Rng>::dealerStep() {
+    if (state != RoundState::DealerTurn) return false;
+    if (dealerHand.getScore() < 17) {
+        dealCard(dealerHand);
+        return true;
+    }
+    settle();
+    return false;
+}
+
+template <typename Rng>
+void BasicBlackjackEngine<Rng>::playDealer() {
+    while (dealerStep()) {}
+}
+
+template <typename Rng>
+void BasicBlackjackEngine<Rng>::settle() {
+    int dealerScore = dealerHand.getScore();
+    int playerScore = playerHand.getScore();
+
+    state = RoundState::Finished;
+    if ((playerScore > dealerScore && playerScore < 22) || dealerScore > 21) {
+        result = RoundResult::PlayerWins;
+    }
+    else if (playerScore == dealerScore) {
+        result = RoundResult::Tie;
+    }
+    else {
+        result = RoundResult::DealerWins;
+    }
+}
+
+template class BasicBlackjackEngine<Xoshiro256StarStar>;
+template class BasicBlackjackEngine<Pcg32>;
+template class BasicBlackjackEngine<Philox4x32>;
+template class BasicBlackjackEngine<std::mt19937>;
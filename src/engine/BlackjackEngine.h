@@ -0,0 +1,82 @@
+#ifndef BLACKJACK_ENGINE_H
+#define BLACKJACK_ENGINE_H
+
+#include <cstdint>
+#include <random>
+#include "Hand.h"
+#include "Shoe.h"
+
+// Where the current round stands.
+enum class RoundState {
+    PlayerTurn, // Player may hit or stand
+    DealerTurn, // Player stood, dealer draws below 17
+    Finished    // Round settled, see getResult()
+};
+
+enum class RoundResult {
+    None,       // Round still in progress
+    PlayerWins,
+    DealerWins,
+    Tie
+};
+
+// Headless blackjack rules: deal, hit, stand, dealer play and settlement.
+// Knows nothing about windows, shaders or textures so it can run millions
+// of rounds per second without a GL context.
+//
+// Rng is the shuffling policy: any generator from Random.h (or std::mt19937).
+// The member functions are instantiated in BlackjackEngine.cpp for every
+// generator listed at the bottom of this file.
+template <typename Rng>
+class BasicBlackjackEngine {
+public:
+    explicit BasicBlackjackEngine(std::uint64_t seed = std::random_device{}(), int decks = 1, double penetration = 1.0)
+        : BasicBlackjackEngine(Rng(seed), decks, penetration) {}
+    BasicBlackjackEngine(const Rng& generator, int decks = 1, double penetration = 1.0);
+
+    void resetDeck();   // Reshuffle the whole shoe, then start a new round
+    void startRound();  // Deal a new round, reshuffling first once the cut card is out
+
+    void hit();         // Player draws a card (PlayerTurn only)
+    void stand();       // Player ends their turn (PlayerTurn only)
+    bool dealerStep();  // Dealer draws one card; returns false once the round is settled
+    void playDealer();  // Run dealerStep() until the round is settled
+
+    RoundState getState() const { return state; }
+    RoundResult getResult() const { return result; }
+    bool isDealerRevealed() const { return playerStood; }
+
+    const Hand& getPlayerHand() const { return playerHand; }
+    const Hand& getDealerHand() const { return dealerHand; }
+    const Shoe& getShoe() const { return shoe; }
+    size_t cardsLeft() const { return static_cast<size_t>(shoe.remaining()); }
+    unsigned long long getRoundNumber() const { return roundNumber; }
+    unsigned long long getDeckResets() const { return deckResets; }
+    unsigned long long getDiscardShuffles() const { return discardShuffles; }
+
+private:
+    void dealInitialCards();
+    bool dealCard(Hand& hand);
+    void settle();
+
+    Hand playerHand;                       // Player's cards
+    Hand dealerHand;                       // Dealer's cards
+    Shoe shoe;                             // Undealt and dealt cards
+    RoundState state;
+    RoundResult result;
+    bool playerStood;                      // Dealer's hole card is hidden until the player stands
+    Rng rng;                               // Random number generator for shuffling
+    unsigned long long roundNumber;        // Rounds dealt so far
+    unsigned long long deckResets;         // Times the shoe was reshuffled
+    unsigned long long discardShuffles;    // Times a round emptied the shoe and played on from its discards
+};
+
+extern template class BasicBlackjackEngine<Xoshiro256StarStar>;
+extern template class BasicBlackjackEngine<Pcg32>;
+extern template class BasicBlackjackEngine<Philox4x32>;
+extern template class BasicBlackjackEngine<std::mt19937>;
+
+// The game and benchmarks use the fast default.
+using BlackjackEngine = BasicBlackjackEngine<Xoshiro256StarStar>;
+
+#endif
@@ -0,0 +1,41 @@
+#include "Card.h"
+#include <array>
+
+#define CARD_SUIT_VALUES 2, 3, 4, 5, 6, 7, 8, 9, 10, 10, 10, 10, 11, 0, 0, 0
+const std::uint8_t Card::kValues[64] = { CARD_SUIT_VALUES, CARD_SUIT_VALUES, CARD_SUIT_VALUES, CARD_SUIT_VALUES };
+#undef CARD_SUIT_VALUES
+
+namespace {
+
+const char* const kSuitNames[Card::kSuits] = { "Spades", "Hearts", "Clubs", "Diamonds" };
+const char* const kRankNames[Card::kRanks] = { "2", "3", "4", "5", "6", "7", "8", "9", "10", "J", "Q", "K", "A" };
+
+struct CardStrings {
+    std::array<std::string, Card::kDeckSize> names;
+    std::array<std::string, Card::kDeckSize> textureKeys;
+
+    CardStrings() {
+        for (int suit = 0; suit < Card::kSuits; ++suit) {
+            for (int rank = 0; rank < Card::kRanks; ++rank) {
+                int index = suit * Card::kRanks + rank;
+                names[index] = std::string(kRankNames[rank]) + " of " + kSuitNames[suit];
+                textureKeys[index] = std::string("card") + kSuitNames[suit] + kRankNames[rank];
+            }
+        }
+    }
+};
+
+const CardStrings& cardStrings() {
+    static const CardStrings strings;
+    return strings;
+}
+
+}
+
+const std::string& Card::getName() const {
+    return cardStrings().names[getIndex()];
+}
+
+const std::string& Card::getTextureKey() const {
+    return cardStrings().textureKeys[getIndex()];
+}
@@ -0,0 +1,41 @@
+#ifndef CARD_H
+#define CARD_H
+
+#include <cstdint>
+#include <string>
+
+// A playing card packed into one byte: suit in the high nibble, rank in the
+// low nibble. Names, values and asset keys live in static tables, so dealing
+// a card is a byte copy and a 52-card deck fits in a single cache line.
+class Card {
+public:
+    enum Suit : std::uint8_t { Spades, Hearts, Clubs, Diamonds };
+    enum Rank : std::uint8_t { Two, Three, Four, Five, Six, Seven, Eight, Nine, Ten, Jack, Queen, King, Ace };
+
+    static const int kSuits = 4;
+    static const int kRanks = 13;
+    static const int kDeckSize = kSuits * kRanks;
+
+    Card() = default;
+    Card(Rank rank, Suit suit) : code(static_cast<std::uint8_t>((suit << 4) | rank)) {}
+
+    Rank getRank() const { return static_cast<Rank>(code & 0x0F); }
+    Suit getSuit() const { return static_cast<Suit>(code >> 4); }
+    int getIndex() const { return getSuit() * kRanks + getRank(); } // 0..51, for per-card tables
+    int getValue() const { return kValues[code]; }
+
+    const std::string& getName() const;       // e.g. "A of Spades"
+    const std::string& getTextureKey() const; // Asset name, e.g. "cardSpadesA"
+
+    bool operator==(Card other) const { return code == other.code; }
+    bool operator!=(Card other) const { return code != other.code; }
+
+private:
+    static const std::uint8_t kValues[64]; // Indexed by the packed code, no unpacking needed
+
+    std::uint8_t code = 0; // Two of Spades until assigned, so a default Card is always a valid index
+};
+
+static_assert(sizeof(Card) == 1, "Card must stay one byte");
+
+#endif
@@ -0,0 +1,50 @@
+#include "DealerOdds.h"
+
+size_t DealerOdds::KeyHash::operator()(const Key& key) const {
+    // splitmix64 finalizer over the packed state
+    std::uint64_t x = key.composition ^ (static_cast<std::uint64_t>(key.hardTotal) << 57) ^ (static_cast<std::uint64_t>(key.hasAce) << 63);
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return static_cast<size_t>(x);
+}
+
+const DealerDistribution& DealerOdds::distribution(int upIndex, const DeckComposition& remaining) {
+    DeckComposition scratch = remaining;
+    return solve(DeckComposition::hardValueOf(upIndex), upIndex == 0, scratch);
+}
+
+const DealerDistribution& DealerOdds::solve(int hardTotal, bool hasAce, DeckComposition& remaining) {
+    Key key{ remaining.key(), static_cast<std::uint8_t>(hardTotal), hasAce };
+    auto found = cache.find(key);
+    if (found != cache.end()) return found->second;
+
+    DealerDistribution result;
+    int score = (hasAce && hardTotal <= 11) ? hardTotal + 10 : hardTotal;
+    if (score >= 17) {
+        result.p[score > 21 ? DealerDistribution::Bust : score - 17] = 1.0;
+    }
+    else if (remaining.total() == 0) {
+        result.p[DealerDistribution::Exhausted] = 1.0;
+    }
+    else {
+        double cards = static_cast<double>(remaining.total());
+        for (int index = 0; index < DeckComposition::kRanks; ++index) {
+            int count = remaining.count(index);
+            if (count == 0) continue;
+            double weight = count / cards;
+
+            remaining.remove(index);
+            const DealerDistribution& next = solve(hardTotal + DeckComposition::hardValueOf(index), hasAce || index == 0, remaining);
+            remaining.add(index);
+
+            for (int outcome = 0; outcome < DealerDistribution::kOutcomes; ++outcome) {
+                result.p[outcome] += weight * next.p[outcome];
+            }
+        }
+    }
+    // Node-based map: references stay valid as it grows
+    return cache.emplace(key, result).first->second;
+}
@@ -0,0 +1,55 @@
+#ifndef DEALER_ODDS_H
+#define DEALER_ODDS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include "DeckComposition.h"
+
+// Probability of each way the dealer's hand can end.
+struct DealerDistribution {
+    enum Outcome { Stand17, Stand18, Stand19, Stand20, Stand21, Bust, Exhausted, kOutcomes };
+
+    double p[kOutcomes] = {};
+
+    // Probability the dealer finishes on `total` (17-21).
+    double standsOn(int total) const { return p[total - 17]; }
+    double bust() const { return p[Bust]; }
+};
+
+// Exact dealer final-total distribution for a given up-card and remaining
+// deck, following the Game rule: the dealer draws while below 17 (soft 17
+// stands). The hole card is drawn from `remaining` like any other card.
+// Running out of cards mid-hand voids the round in the engine, so that mass
+// is reported as Exhausted rather than folded into a total.
+//
+// Every intermediate dealer state is memoized on (deck composition, hard
+// total, holds an ace), so repeated queries during a shoe and different
+// draw orders that reach the same state are computed once.
+class DealerOdds {
+public:
+    // `upIndex` is a DeckComposition index; `remaining` must not contain the up-card.
+    const DealerDistribution& distribution(int upIndex, const DeckComposition& remaining);
+
+    void clear() { cache.clear(); }
+    size_t cacheSize() const { return cache.size(); }
+
+private:
+    struct Key {
+        std::uint64_t composition;
+        std::uint8_t hardTotal;
+        bool hasAce;
+        bool operator==(const Key& other) const {
+            return composition == other.composition && hardTotal == other.hardTotal && hasAce == other.hasAce;
+        }
+    };
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    const DealerDistribution& solve(int hardTotal, bool hasAce, DeckComposition& remaining);
+
+    std::unordered_map<Key, DealerDistribution, KeyHash> cache;
+};
+
+#endif
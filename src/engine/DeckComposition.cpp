@@ -0,0 +1,16 @@
+#include "DeckComposition.h"
+
+DeckComposition DeckComposition::fullDecks(int decks) {
+    DeckComposition composition;
+    for (int index = 0; index < kRanks - 1; ++index) composition.add(index, 4 * decks);
+    composition.add(kRanks - 1, 16 * decks);
+    return composition;
+}
+
+std::uint64_t DeckComposition::key() const {
+    std::uint64_t packed = counts[kRanks - 1];
+    for (int index = 0; index < kRanks - 1; ++index) {
+        packed = (packed << 6) | counts[index];
+    }
+    return packed;
+}
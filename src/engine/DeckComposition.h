@@ -0,0 +1,45 @@
+#ifndef DECK_COMPOSITION_H
+#define DECK_COMPOSITION_H
+
+#include <cstdint>
+#include "Card.h"
+
+// Remaining cards counted by blackjack value, which is all the odds and
+// strategy code cares about. Index 0 is aces, 1-8 are twos to nines and 9 is
+// every ten-valued card.
+class DeckComposition {
+public:
+    static const int kRanks = 10;
+    static const int kMaxDecks = 15; // Keeps key() within 64 bits
+
+    DeckComposition() : counts(), cards(0) {}
+
+    static DeckComposition fullDecks(int decks);
+    template <typename It>
+    static DeckComposition fromCards(It first, It last) {
+        DeckComposition composition;
+        for (; first != last; ++first) composition.add(indexOf(*first));
+        return composition;
+    }
+
+    static int indexOf(Card card) { return card.getValue() == 11 ? 0 : card.getValue() - 1; }
+    static int valueOf(int index) { return index == 0 ? 11 : index + 1; }
+    static int hardValueOf(int index) { return index + 1; } // Aces as 1
+
+    void add(int index, int n = 1) { counts[index] = static_cast<std::uint8_t>(counts[index] + n); cards += n; }
+    void remove(int index, int n = 1) { counts[index] = static_cast<std::uint8_t>(counts[index] - n); cards -= n; }
+
+    int count(int index) const { return counts[index]; }
+    int total() const { return cards; }
+
+    // Packs all ten counts: 6 bits for each non-ten rank, 8 bits for tens.
+    std::uint64_t key() const;
+
+    bool operator==(const DeckComposition& other) const { return key() == other.key(); }
+
+private:
+    std::uint8_t counts[kRanks];
+    int cards;
+};
+
+#endif
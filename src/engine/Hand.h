@@ -0,0 +1,62 @@
+#ifndef HAND_H
+#define HAND_H
+
+#include <cassert>
+#include <cstdint>
+#include "Card.h"
+
+// A hand of cards with its score kept up to date as cards are added.
+// Storage is inline: a hand that has not yet gone over 21 holds at most 20
+// points of aces, so 21 cards is the largest possible hand at any deck
+// count and no hand ever touches the heap.
+class Hand {
+public:
+    static const int kMaxCards = 21;
+
+    Hand() : count(0), hardTotal(0), aceCount(0), score(0) {}
+
+    void add(Card card) {
+        assert(count < kMaxCards);
+        cards[count++] = card;
+        int value = card.getValue();
+        if (value == 11) {
+            ++aceCount;
+            value = 1;
+        }
+        hardTotal = static_cast<std::uint8_t>(hardTotal + value);
+        // Two aces can never both count 11, so at most one is ever soft
+        score = static_cast<std::uint8_t>((aceCount > 0 && hardTotal <= 11) ? hardTotal + 10 : hardTotal);
+    }
+
+    void clear() {
+        count = 0;
+        hardTotal = 0;
+        aceCount = 0;
+        score = 0;
+    }
+
+    int getScore() const { return score; }          // Best total, aces counted 11 where it doesn't bust
+    int getHardTotal() const { return hardTotal; }  // All aces counted as 1
+    int getAceCount() const { return aceCount; }
+    int getSoftAces() const { return score != hardTotal ? 1 : 0; } // Aces currently counted as 11
+    bool isSoft() const { return score != hardTotal; }
+    bool isBust() const { return score > 21; }
+    bool isBlackjack() const { return count == 2 && score == 21; }
+
+    int size() const { return count; }
+    bool empty() const { return count == 0; }
+    Card operator[](int i) const { return cards[i]; }
+    Card front() const { return cards[0]; }
+    Card back() const { return cards[count - 1]; }
+    const Card* begin() const { return cards; }
+    const Card* end() const { return cards + count; }
+
+private:
+    Card cards[kMaxCards];
+    std::uint8_t count;
+    std::uint8_t hardTotal;
+    std::uint8_t aceCount;
+    std::uint8_t score;
+};
+
+#endif
@@ -0,0 +1,133 @@
+#include "HandBatch.h"
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define HAND_BATCH_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define HAND_BATCH_SSE2 1
+#endif
+
+HandBatch::HandBatch(size_t hands) : count(0), stride(0) {
+    resize(hands);
+}
+
+void HandBatch::resize(size_t hands) {
+    count = hands;
+    stride = (hands + kLaneWidth - 1) / kLaneWidth * kLaneWidth;
+    values.assign(stride * Hand::kMaxCards, 0);
+}
+
+void HandBatch::clear() {
+    std::fill(values.begin(), values.end(), static_cast<std::uint8_t>(0));
+}
+
+void HandBatch::setHand(size_t hand, const Hand& cards) {
+    for (int slot = 0; slot < Hand::kMaxCards; ++slot) {
+        values[slot * stride + hand] = slot < cards.size() ? static_cast<std::uint8_t>(cards[slot].getValue()) : 0;
+    }
+}
+
+// Every kernel computes the same thing per hand: the hard total with aces
+// as 1, plus 10 when the hand holds an ace and that still fits in 21. This
+// equals Hand::getScore() because two aces can never both count as 11.
+
+void scoreHandsScalar(const HandBatch& batch, HandBatchScores& scores) {
+    size_t stride = batch.getStride();
+    scores.totals.assign(stride, 0);
+    scores.aceCounts.assign(stride, 0);
+    std::uint8_t* hard = scores.totals.data();
+    std::uint8_t* aces = scores.aceCounts.data();
+
+    // Slot-major so each pass streams one contiguous lane
+    for (int slot = 0; slot < Hand::kMaxCards; ++slot) {
+        const std::uint8_t* values = batch.lane(slot);
+        for (size_t hand = 0; hand < stride; ++hand) {
+            bool isAce = values[hand] == 11;
+            hard[hand] = static_cast<std::uint8_t>(hard[hand] + (isAce ? 1 : values[hand]));
+            aces[hand] = static_cast<std::uint8_t>(aces[hand] + (isAce ? 1 : 0));
+        }
+    }
+    for (size_t hand = 0; hand < stride; ++hand) {
+        if (aces[hand] > 0 && hard[hand] <= 11) hard[hand] = static_cast<std::uint8_t>(hard[hand] + 10);
+    }
+}
+
+#if defined(HAND_BATCH_AVX2)
+
+static void scoreHandsAvx2(const HandBatch& batch, HandBatchScores& scores) {
+    size_t stride = batch.getStride();
+    scores.totals.resize(stride);
+    scores.aceCounts.resize(stride);
+
+    const __m256i eleven = _mm256_set1_epi8(11);
+    const __m256i ten = _mm256_set1_epi8(10);
+    const __m256i zero = _mm256_setzero_si256();
+
+    for (size_t hand = 0; hand < stride; hand += 32) {
+        __m256i hard = zero;
+        __m256i aces = zero;
+        for (int slot = 0; slot < Hand::kMaxCards; ++slot) {
+            __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(batch.lane(slot) + hand));
+            __m256i isAce = _mm256_cmpeq_epi8(value, eleven);            // 0xFF where ace
+            hard = _mm256_add_epi8(hard, _mm256_sub_epi8(value, _mm256_and_si256(isAce, ten)));
+            aces = _mm256_sub_epi8(aces, isAce);                         // -(-1) counts aces
+        }
+        __m256i fits = _mm256_cmpeq_epi8(_mm256_min_epu8(hard, eleven), hard); // hard <= 11
+        __m256i hasAce = _mm256_andnot_si256(_mm256_cmpeq_epi8(aces, zero), fits);
+        __m256i total = _mm256_add_epi8(hard, _mm256_and_si256(hasAce, ten));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(scores.totals.data() + hand), total);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(scores.aceCounts.data() + hand), aces);
+    }
+}
+
+#elif defined(HAND_BATCH_SSE2)
+
+static void scoreHandsSse2(const HandBatch& batch, HandBatchScores& scores) {
+    size_t stride = batch.getStride();
+    scores.totals.resize(stride);
+    scores.aceCounts.resize(stride);
+
+    const __m128i eleven = _mm_set1_epi8(11);
+    const __m128i ten = _mm_set1_epi8(10);
+    const __m128i zero = _mm_setzero_si128();
+
+    for (size_t hand = 0; hand < stride; hand += 16) {
+        __m128i hard = zero;
+        __m128i aces = zero;
+        for (int slot = 0; slot < Hand::kMaxCards; ++slot) {
+            __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(batch.lane(slot) + hand));
+            __m128i isAce = _mm_cmpeq_epi8(value, eleven);
+            hard = _mm_add_epi8(hard, _mm_sub_epi8(value, _mm_and_si128(isAce, ten)));
+            aces = _mm_sub_epi8(aces, isAce);
+        }
+        __m128i fits = _mm_cmpeq_epi8(_mm_min_epu8(hard, eleven), hard);
+        __m128i hasAce = _mm_andnot_si128(_mm_cmpeq_epi8(aces, zero), fits);
+        __m128i total = _mm_add_epi8(hard, _mm_and_si128(hasAce, ten));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(scores.totals.data() + hand), total);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(scores.aceCounts.data() + hand), aces);
+    }
+}
+
+#endif
+
+void scoreHands(const HandBatch& batch, HandBatchScores& scores) {
+#if defined(HAND_BATCH_AVX2)
+    scoreHandsAvx2(batch, scores);
+#elif defined(HAND_BATCH_SSE2)
+    scoreHandsSse2(batch, scores);
+#else
+    scoreHandsScalar(batch, scores);
+#endif
+}
+
+const char* scoreHandsKernel() {
+#if defined(HAND_BATCH_AVX2)
+    return "AVX2";
+#elif defined(HAND_BATCH_SSE2)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
@@ -0,0 +1,50 @@
+#ifndef HAND_BATCH_H
+#define HAND_BATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Hand.h"
+
+// Many hands stored structure-of-arrays: one lane of card values per card
+// slot, so slot k of 32 consecutive hands is one contiguous 32-byte load.
+// Empty slots hold 0. The hand count is padded to kLaneWidth so kernels
+// never need a scalar tail.
+class HandBatch {
+public:
+    static const size_t kLaneWidth = 32;
+
+    explicit HandBatch(size_t hands = 0);
+
+    void resize(size_t hands);
+    void clear();                             // Empty every hand, keep capacity
+    void setHand(size_t hand, const Hand& cards);
+    void addCard(size_t hand, int slot, Card card) { values[slot * stride + hand] = static_cast<std::uint8_t>(card.getValue()); }
+
+    size_t size() const { return count; }
+    size_t getStride() const { return stride; }
+    const std::uint8_t* lane(int slot) const { return values.data() + slot * stride; }
+
+private:
+    size_t count;
+    size_t stride;                            // count rounded up to kLaneWidth
+    std::vector<std::uint8_t> values;         // values[slot * stride + hand]
+};
+
+// Per-hand outputs, padded to the batch stride.
+struct HandBatchScores {
+    std::vector<std::uint8_t> totals;         // Same as Hand::getScore()
+    std::vector<std::uint8_t> aceCounts;
+};
+
+// Scores every hand in the batch with the widest kernel this build targets:
+// AVX2 (32 hands per step), SSE2 (16) or scalar.
+void scoreHands(const HandBatch& batch, HandBatchScores& scores);
+
+// Portable reference kernel, always available.
+void scoreHandsScalar(const HandBatch& batch, HandBatchScores& scores);
+
+// Name of the kernel scoreHands() dispatches to, for benchmarks.
+const char* scoreHandsKernel();
+
+#endif
@@ -0,0 +1,81 @@
+#include "ParallelFor.h"
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Owner pops from the back, thieves take from the front.
+struct WorkQueue {
+    std::mutex mutex;
+    std::deque<size_t> tasks;
+
+    bool popBack(size_t& task) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (tasks.empty()) return false;
+        task = tasks.back();
+        tasks.pop_back();
+        return true;
+    }
+
+    bool stealFront(size_t& task) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (tasks.empty()) return false;
+        task = tasks.front();
+        tasks.pop_front();
+        return true;
+    }
+};
+
+}
+
+int resolveThreadCount(int threads, size_t taskCount) {
+    if (threads <= 0) {
+        threads = static_cast<int>(std::thread::hardware_concurrency());
+        if (threads <= 0) threads = 1;
+    }
+    return static_cast<int>(std::max<size_t>(1, std::min<size_t>(threads, taskCount)));
+}
+
+void parallelFor(size_t taskCount, int threads, const std::function<void(size_t task, int worker)>& task) {
+    if (taskCount == 0) return;
+    int workers = resolveThreadCount(threads, taskCount);
+
+    if (workers == 1) {
+        for (size_t i = 0; i < taskCount; ++i) task(i, 0);
+        return;
+    }
+
+    // Tasks are queued in reverse so owners run their block front to back
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    for (int w = 0; w < workers; ++w) {
+        queues.emplace_back(new WorkQueue());
+        size_t begin = taskCount * w / workers;
+        size_t end = taskCount * (w + 1) / workers;
+        for (size_t i = end; i > begin; --i) queues[w]->tasks.push_back(i - 1);
+    }
+
+    auto worker = [&](int self) {
+        size_t index;
+        for (;;) {
+            if (queues[self]->popBack(index)) {
+                task(index, self);
+                continue;
+            }
+            bool stole = false;
+            for (int offset = 1; offset < workers && !stole; ++offset) {
+                stole = queues[(self + offset) % workers]->stealFront(index);
+            }
+            if (!stole) return; // Nothing is ever re-queued, so empty everywhere means done
+            task(index, self);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (int w = 1; w < workers; ++w) pool.emplace_back(worker, w);
+    worker(0);
+    for (auto& thread : pool) thread.join();
+}
@@ -0,0 +1,17 @@
+#ifndef PARALLEL_FOR_H
+#define PARALLEL_FOR_H
+
+#include <cstddef>
+#include <functional>
+
+// Runs task(index, worker) for every index in [0, taskCount) on `threads`
+// workers (0 = one per hardware thread). Each worker starts with a
+// contiguous block of indices and steals from the other end of a busier
+// worker's block once its own runs dry, so uneven task costs still keep
+// every core busy. `worker` is in [0, workerCount) for per-thread state.
+void parallelFor(size_t taskCount, int threads, const std::function<void(size_t task, int worker)>& task);
+
+// Number of workers parallelFor will actually use for a request.
+int resolveThreadCount(int threads, size_t taskCount);
+
+#endif
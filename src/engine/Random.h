@@ -0,0 +1,184 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+// Random number generators for shuffling and simulation. Each is a
+// UniformRandomBitGenerator, so any of them (or std::mt19937) can be the
+// Rng policy of Shoe::shuffle and BasicBlackjackEngine. Unlike std::shuffle,
+// shuffleCards() below is fully specified here, so a given generator and
+// seed deal the same cards with every standard library.
+
+// Seed expander used to initialise the larger generators.
+class SplitMix64 {
+public:
+    using result_type = std::uint64_t;
+
+    explicit SplitMix64(std::uint64_t seed = 0) : state(seed) {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return ~result_type(0); }
+
+    result_type operator()() {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+private:
+    std::uint64_t state;
+};
+
+// xoshiro256** (Blackman & Vigna): 32 bytes of state, very fast, 64-bit output.
+class Xoshiro256StarStar {
+public:
+    using result_type = std::uint64_t;
+
+    explicit Xoshiro256StarStar(std::uint64_t seed = 1) {
+        SplitMix64 expand(seed);
+        for (auto& word : s) word = expand();
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return ~result_type(0); }
+
+    result_type operator()() {
+        std::uint64_t result = rotl(s[1] * 5, 7) * 9;
+        std::uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+        return result;
+    }
+
+private:
+    static std::uint64_t rotl(std::uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+    std::uint64_t s[4];
+};
+
+// PCG32 (O'Neill, XSH-RR): 16 bytes of state, 32-bit output, selectable stream.
+class Pcg32 {
+public:
+    using result_type = std::uint32_t;
+
+    explicit Pcg32(std::uint64_t seed = 1, std::uint64_t stream = 0xDA3E39CB94B95BDBULL)
+        : state(0), increment((stream << 1) | 1) {
+        (*this)();
+        state += seed;
+        (*this)();
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return ~result_type(0); }
+
+    result_type operator()() {
+        std::uint64_t old = state;
+        state = old * 6364136223846793005ULL + increment;
+        std::uint32_t xorshifted = static_cast<std::uint32_t>(((old >> 18) ^ old) >> 27);
+        std::uint32_t rot = static_cast<std::uint32_t>(old >> 59);
+        return (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+    }
+
+private:
+    std::uint64_t state;
+    std::uint64_t increment;
+};
+
+// Philox4x32-10 (Salmon et al., Random123): counter-based, so the stream for
+// (seed, stream) is a pure function of its inputs. Splitting work into
+// independent reproducible streams is just a matter of picking stream ids.
+class Philox4x32 {
+public:
+    using result_type = std::uint32_t;
+
+    explicit Philox4x32(std::uint64_t seed = 1, std::uint64_t stream = 0) : next(4) {
+        key[0] = static_cast<std::uint32_t>(seed);
+        key[1] = static_cast<std::uint32_t>(seed >> 32);
+        counter[0] = 0;
+        counter[1] = 0;
+        counter[2] = static_cast<std::uint32_t>(stream);
+        counter[3] = static_cast<std::uint32_t>(stream >> 32);
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return ~result_type(0); }
+
+    result_type operator()() {
+        if (next == 4) {
+            generate(counter, key, block);
+            if (++counter[0] == 0) ++counter[1];
+            next = 0;
+        }
+        return block[next++];
+    }
+
+    // One Philox4x32-10 block, exposed for known-answer checks.
+    static void generate(const std::uint32_t in[4], const std::uint32_t inKey[2], std::uint32_t out[4]) {
+        std::uint32_t c[4] = { in[0], in[1], in[2], in[3] };
+        std::uint32_t k[2] = { inKey[0], inKey[1] };
+        for (int round = 0; round < 10; ++round) {
+            if (round > 0) {
+                k[0] += 0x9E3779B9u;
+                k[1] += 0xBB67AE85u;
+            }
+            std::uint64_t p0 = static_cast<std::uint64_t>(0xD2511F53u) * c[0];
+            std::uint64_t p1 = static_cast<std::uint64_t>(0xCD9E8D57u) * c[2];
+            std::uint32_t next0 = static_cast<std::uint32_t>(p1 >> 32) ^ c[1] ^ k[0];
+            std::uint32_t next2 = static_cast<std::uint32_t>(p0 >> 32) ^ c[3] ^ k[1];
+            c[1] = static_cast<std::uint32_t>(p1);
+            c[3] = static_cast<std::uint32_t>(p0);
+            c[0] = next0;
+            c[2] = next2;
+        }
+        for (int i = 0; i < 4; ++i) out[i] = c[i];
+    }
+
+private:
+    std::uint32_t key[2];
+    std::uint32_t counter[4];
+    std::uint32_t block[4];
+    int next;
+};
+
+// 32 uniform bits from any generator whose range is 32 or 64 full bits.
+template <typename Rng>
+inline std::uint32_t next32(Rng& rng) {
+    static_assert(Rng::min() == 0, "generator must start at 0");
+    if (Rng::max() > 0xFFFFFFFFu) return static_cast<std::uint32_t>(static_cast<std::uint64_t>(rng()) >> 32);
+    return static_cast<std::uint32_t>(rng());
+}
+
+// Unbiased integer in [0, bound), Lemire's multiply-and-reject method.
+template <typename Rng>
+inline std::uint32_t uniformBelow(Rng& rng, std::uint32_t bound) {
+    std::uint64_t product = static_cast<std::uint64_t>(next32(rng)) * bound;
+    std::uint32_t low = static_cast<std::uint32_t>(product);
+    if (low < bound) {
+        std::uint32_t threshold = static_cast<std::uint32_t>(-bound) % bound;
+        while (low < threshold) {
+            product = static_cast<std::uint64_t>(next32(rng)) * bound;
+            low = static_cast<std::uint32_t>(product);
+        }
+    }
+    return static_cast<std::uint32_t>(product >> 32);
+}
+
+// Fisher-Yates shuffle with a portable, fully specified draw sequence.
+template <typename RandomIt, typename Rng>
+void shuffleCards(RandomIt first, RandomIt last, Rng& rng) {
+    auto count = std::distance(first, last);
+    for (auto i = count - 1; i > 0; --i) {
+        auto j = uniformBelow(rng, static_cast<std::uint32_t>(i + 1));
+        using std::swap;
+        swap(first[i], first[j]);
+    }
+}
+
+#endif
@@ -0,0 +1,17 @@
+#include "Shoe.h"
+#include <algorithm>
+
+Shoe::Shoe(int decks, double penetration) : undealt(0), decks(std::max(1, decks)) {
+    cards.reserve(static_cast<size_t>(this->decks) * Card::kDeckSize);
+    for (int deck = 0; deck < this->decks; ++deck) {
+        for (int suit = 0; suit < Card::kSuits; ++suit) {
+            for (int rank = 0; rank < Card::kRanks; ++rank) {
+                cards.emplace_back(static_cast<Card::Rank>(rank), static_cast<Card::Suit>(suit));
+            }
+        }
+    }
+    undealt = size();
+
+    penetration = std::min(1.0, std::max(0.0, penetration));
+    cutPosition = std::min(static_cast<int>(penetration * size()), size() - kMinCardsPerRound);
+}
@@ -0,0 +1,60 @@
+#ifndef SHOE_H
+#define SHOE_H
+
+#include <algorithm>
+#include <vector>
+#include "Card.h"
+#include "Random.h"
+
+// A dealing shoe of one or more 52-card decks with a cut card. The card
+// buffer is allocated once; reshuffling permutes it in place, so a shoe
+// never allocates after construction. Cards are dealt from the back of the
+// buffer, so the undealt cards are always [begin(), end()).
+class Shoe {
+public:
+    static const int kMinCardsPerRound = 4; // Cut card never sits closer to the end than this
+
+    // `penetration` is the fraction of the shoe dealt before the cut card
+    // comes out, e.g. 0.75 for a 6-deck shoe cut 1.5 decks from the end.
+    explicit Shoe(int decks = 1, double penetration = 1.0);
+
+    // Gather every card back and shuffle in place. Dealt cards are still in
+    // the buffer past `undealt`, so this always permutes the full shoe.
+    template <typename Rng>
+    void shuffle(Rng& rng) {
+        shuffleCards(cards.begin(), cards.end(), rng);
+        undealt = size();
+    }
+
+    // For a round that empties the shoe: shuffles every dealt card except
+    // the `inPlay` dealt last back in, leaving those dealt. Dealt cards sit
+    // past `undealt` newest first, so with the shoe empty the cards in play
+    // are the first `inPlay`; they move to the end before the shuffle.
+    template <typename Rng>
+    void reshuffleDiscards(Rng& rng, int inPlay) {
+        std::rotate(cards.begin(), cards.begin() + inPlay, cards.end());
+        shuffleCards(cards.begin(), cards.end() - inPlay, rng);
+        undealt = size() - inPlay;
+    }
+
+    Card deal() { return cards[--undealt]; } // Caller checks empty() first
+
+    bool empty() const { return undealt == 0; }
+    bool needsShuffle() const { return dealt() > cutPosition; } // Cut card is out
+    int remaining() const { return undealt; }
+    int dealt() const { return static_cast<int>(cards.size()) - undealt; }
+    int size() const { return static_cast<int>(cards.size()); }
+    int getDecks() const { return decks; }
+    int getCutPosition() const { return cutPosition; }
+
+    const Card* begin() const { return cards.data(); }
+    const Card* end() const { return cards.data() + undealt; }
+
+private:
+    std::vector<Card> cards;
+    int undealt;
+    int decks;
+    int cutPosition;   // Cards dealt before the cut card
+};
+
+#endif
@@ -0,0 +1,78 @@
+#include "Simulator.h"
+#include "BlackjackEngine.h"
+#include "ParallelFor.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+void SimulationStats::merge(const SimulationStats& other) {
+    rounds += other.rounds;
+    playerWins += other.playerWins;
+    dealerWins += other.dealerWins;
+    ties += other.ties;
+    voided += other.voided;
+    reshuffled += other.reshuffled;
+}
+
+double SimulationStats::houseEdge() const {
+    if (rounds == 0) return 0.0;
+    return (static_cast<double>(dealerWins) - static_cast<double>(playerWins)) / static_cast<double>(rounds);
+}
+
+double SimulationStats::standardError() const {
+    if (rounds < 2) return 0.0;
+    double n = static_cast<double>(rounds);
+    double mean = houseEdge();
+    double meanSquare = (static_cast<double>(playerWins) + static_cast<double>(dealerWins)) / n;
+    double variance = std::max(0.0, meanSquare - mean * mean) * n / (n - 1.0);
+    return std::sqrt(variance / n);
+}
+
+SimulationStats simulateChunk(const SimulationConfig& config, unsigned long long chunk, unsigned long long rounds) {
+    // Philox stream `chunk` under key `seed`: independent of every other
+    // chunk and identical with every compiler and standard library
+    BasicBlackjackEngine<Philox4x32> engine(Philox4x32(config.seed, chunk), config.decks, config.penetration);
+    SimulationStats stats;
+
+    for (unsigned long long i = 0; i < rounds; ++i) {
+        engine.startRound();
+        const unsigned long long discardShuffles = engine.getDiscardShuffles();
+        while (engine.getState() == RoundState::PlayerTurn &&
+               engine.getPlayerHand().getScore() < config.playerStandsOn) {
+            engine.hit();
+        }
+        engine.stand();
+        engine.playDealer();
+
+        switch (engine.getResult()) {
+        case RoundResult::PlayerWins: ++stats.playerWins; break;
+        case RoundResult::DealerWins: ++stats.dealerWins; break;
+        case RoundResult::Tie: ++stats.ties; break;
+        default: ++stats.voided; continue; // Every card of the shoe was in play, which 52 never are
+        }
+        if (engine.getDiscardShuffles() != discardShuffles) ++stats.reshuffled;
+        ++stats.rounds;
+    }
+    return stats;
+}
+
+SimulationStats simulate(const SimulationConfig& config) {
+    unsigned long long perChunk = std::max<unsigned long long>(1, config.roundsPerChunk);
+    unsigned long long chunks = (config.rounds + perChunk - 1) / perChunk;
+
+    // One slot per worker, padded so hot counters never share a cache line
+    struct alignas(64) WorkerStats {
+        SimulationStats stats;
+    };
+    std::vector<WorkerStats> perWorker(resolveThreadCount(config.threads, static_cast<size_t>(chunks)));
+
+    parallelFor(static_cast<size_t>(chunks), config.threads, [&](size_t chunk, int worker) {
+        unsigned long long first = chunk * perChunk;
+        unsigned long long count = std::min(perChunk, config.rounds - first);
+        perWorker[worker].stats.merge(simulateChunk(config, chunk, count));
+    });
+
+    SimulationStats total;
+    for (const auto& slot : perWorker) total.merge(slot.stats);
+    return total;
+}
@@ -0,0 +1,41 @@
+#ifndef SIMULATOR_H
+#define SIMULATOR_H
+
+struct SimulationConfig {
+    unsigned long long rounds = 1000000;
+    unsigned long long seed = 1;
+    int threads = 0;                            // 0 = one per hardware thread
+    int playerStandsOn = 17;                    // Player hits below this total
+    int decks = 1;
+    double penetration = 1.0;                   // Fraction of the shoe dealt before reshuffling
+    unsigned long long roundsPerChunk = 1 << 16; // Unit of work and of RNG streams
+};
+
+// Integer tallies only, so merging is exact and order-independent.
+struct SimulationStats {
+    unsigned long long rounds = 0;
+    unsigned long long playerWins = 0;
+    unsigned long long dealerWins = 0;
+    unsigned long long ties = 0;
+    unsigned long long voided = 0;     // Rounds that could not be finished, not in `rounds`
+    unsigned long long reshuffled = 0; // Rounds finished from the shoe's reshuffled discards, in `rounds`
+
+    void merge(const SimulationStats& other);
+
+    // House edge per unit bet: ties push, wins and losses pay even money.
+    double houseEdge() const;
+    // Standard error of houseEdge(); multiply by 1.96 for a 95% interval.
+    double standardError() const;
+};
+
+// Plays config.rounds rounds of the Game rules (dealer draws below 17, ties
+// push) across all cores. Rounds are split into fixed-size chunks and every
+// chunk gets its own engine and Philox stream (key = seed, stream = chunk
+// index), so the result depends only on the seed: never on the thread
+// count, on which worker ran which chunk, or on the standard library.
+SimulationStats simulate(const SimulationConfig& config);
+
+// Plays one chunk; simulate() is the sum of these over all chunks.
+SimulationStats simulateChunk(const SimulationConfig& config, unsigned long long chunk, unsigned long long rounds);
+
+#endif
@@ -0,0 +1,168 @@
+#include "StrategySolver.h"
+#include "DealerOdds.h"
+#include "ParallelFor.h"
+
+namespace {
+
+// Dealer odds depend only on their inputs, so each thread keeps its own
+// memo instead of contending for a shared one.
+thread_local DealerOdds dealerOdds;
+
+int scoreOf(int hardTotal, bool hasAce) {
+    return (hasAce && hardTotal <= 11) ? hardTotal + 10 : hardTotal;
+}
+
+double standValue(int score, int upIndex, const DeckComposition& remaining) {
+    const DealerDistribution& dealer = dealerOdds.distribution(upIndex, remaining);
+    double value = dealer.bust();
+    for (int total = 17; total <= 21; ++total) {
+        if (score > total) value += dealer.standsOn(total);
+        else if (score < total) value -= dealer.standsOn(total);
+    }
+    return value;
+}
+
+// Hitting to exactly 21 ends the round before the dealer draws; only a
+// dealer two-card 21 (ace plus ten) ties it.
+double twentyOneValue(int upIndex, const DeckComposition& remaining) {
+    if (remaining.total() == 0) return 0.0;
+    int matching = 0;
+    if (upIndex == 0) matching = remaining.count(DeckComposition::kRanks - 1);
+    else if (upIndex == DeckComposition::kRanks - 1) matching = remaining.count(0);
+    return 1.0 - static_cast<double>(matching) / remaining.total();
+}
+
+}
+
+StrategySolver::StrategySolver() : shards(new Shard[kShards]) {}
+
+size_t StrategySolver::KeyHash::operator()(const Key& key) const {
+    std::uint64_t x = key.composition ^
+                      (static_cast<std::uint64_t>(key.hardTotal) << 40) ^
+                      (static_cast<std::uint64_t>(key.upIndex) << 48) ^
+                      (static_cast<std::uint64_t>(key.hasAce) << 63);
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return static_cast<size_t>(x);
+}
+
+bool StrategySolver::lookup(const Key& key, ActionValues& values) const {
+    Shard& shard = shardFor(KeyHash()(key));
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto found = shard.entries.find(key);
+    if (found == shard.entries.end()) return false;
+    values = found->second;
+    return true;
+}
+
+void StrategySolver::store(const Key& key, const ActionValues& values) {
+    Shard& shard = shardFor(KeyHash()(key));
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.entries.emplace(key, values);
+}
+
+size_t StrategySolver::tableSize() const {
+    size_t size = 0;
+    for (size_t i = 0; i < kShards; ++i) {
+        std::lock_guard<std::mutex> lock(shards[i].mutex);
+        size += shards[i].entries.size();
+    }
+    return size;
+}
+
+void StrategySolver::clear() {
+    for (size_t i = 0; i < kShards; ++i) {
+        std::lock_guard<std::mutex> lock(shards[i].mutex);
+        shards[i].entries.clear();
+    }
+}
+
+ActionValues StrategySolver::evaluate(int hardTotal, bool hasAce, int upIndex, const DeckComposition& remaining) {
+    DeckComposition scratch = remaining;
+    return solve(hardTotal, hasAce, upIndex, scratch);
+}
+
+ActionValues StrategySolver::evaluate(const Hand& player, Card dealerUp, const DeckComposition& remaining) {
+    return evaluate(player.getHardTotal(), player.getAceCount() > 0, DeckComposition::indexOf(dealerUp), remaining);
+}
+
+ActionValues StrategySolver::evaluate(const Hand& player, const Hand& dealer, const Shoe& shoe) {
+    DeckComposition remaining = DeckComposition::fromCards(shoe.begin(), shoe.end());
+    for (int i = 1; i < dealer.size(); ++i) remaining.add(DeckComposition::indexOf(dealer[i]));
+    return evaluate(player, dealer.front(), remaining);
+}
+
+ActionValues StrategySolver::solve(int hardTotal, bool hasAce, int upIndex, DeckComposition& remaining) {
+    Key key{ remaining.key(), static_cast<std::uint8_t>(hardTotal), static_cast<std::uint8_t>(hasAce), static_cast<std::uint8_t>(upIndex) };
+    ActionValues values;
+    if (lookup(key, values)) return values;
+
+    values.stand = standValue(scoreOf(hardTotal, hasAce), upIndex, remaining);
+
+    if (remaining.total() > 0) {
+        double cards = static_cast<double>(remaining.total());
+        for (int index = 0; index < DeckComposition::kRanks; ++index) {
+            int count = remaining.count(index);
+            if (count == 0) continue;
+
+            int nextHard = hardTotal + DeckComposition::hardValueOf(index);
+            bool nextAce = hasAce || index == 0;
+            int nextScore = scoreOf(nextHard, nextAce);
+
+            remaining.remove(index);
+            double next;
+            if (nextScore > 21) next = -1.0;
+            else if (nextScore == 21) next = twentyOneValue(upIndex, remaining);
+            else next = solve(nextHard, nextAce, upIndex, remaining).best();
+            remaining.add(index);
+
+            values.hit += count / cards * next;
+        }
+    }
+
+    store(key, values);
+    return values;
+}
+
+StrategyTable solveBasicStrategy(StrategySolver& solver, int decks, int threads) {
+    StrategyTable table;
+    table.decks = decks;
+    const DeckComposition shoe = DeckComposition::fullDecks(decks);
+    const int ten = DeckComposition::kRanks - 1;
+    const int rows = StrategyTable::kHardRows + StrategyTable::kSoftRows;
+
+    // One task per (row, up-card); the shared table lets cells reuse each other's subtrees
+    parallelFor(static_cast<size_t>(rows) * DeckComposition::kRanks, threads, [&](size_t task, int) {
+        int row = static_cast<int>(task / DeckComposition::kRanks);
+        int up = static_cast<int>(task % DeckComposition::kRanks);
+
+        // Representative two-card hands: 2+x for hard 5-11, ten+x for hard
+        // 12-20, ace+x for soft totals
+        int first, second;
+        bool soft = row >= StrategyTable::kHardRows;
+        if (soft) {
+            int total = StrategyTable::kSoftFirst + row - StrategyTable::kHardRows;
+            first = 0;
+            second = total - 12;
+        }
+        else {
+            int total = StrategyTable::kHardFirst + row;
+            first = total <= 11 ? 1 : ten;
+            second = total <= 11 ? total - 3 : total - 11;
+        }
+
+        DeckComposition remaining = shoe;
+        remaining.remove(up);
+        remaining.remove(first);
+        remaining.remove(second);
+        int hard = DeckComposition::hardValueOf(first) + DeckComposition::hardValueOf(second);
+        ActionValues values = solver.evaluate(hard, soft, up, remaining);
+
+        if (soft) table.soft[row - StrategyTable::kHardRows][up] = values;
+        else table.hard[row][up] = values;
+    });
+    return table;
+}
@@ -0,0 +1,100 @@
+#ifndef STRATEGY_SOLVER_H
+#define STRATEGY_SOLVER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "BlackjackEngine.h"
+#include "DeckComposition.h"
+
+enum class Action { Stand, Hit };
+
+// Expected value per unit bet of each action the Game offers. The Game has
+// no double or split, so neither is modelled.
+struct ActionValues {
+    double stand = 0.0;
+    double hit = 0.0;
+
+    Action bestAction() const { return hit > stand ? Action::Hit : Action::Stand; }
+    double best() const { return hit > stand ? hit : stand; }
+};
+
+// Composition-dependent hit/stand solver for the Game rules:
+//  - reaching exactly 21 on a hit ends the round at once; the player wins
+//    unless the dealer's two cards also make 21, which ties
+//  - going over 21 loses; otherwise the dealer draws below 17 and ties push
+//  - running out of cards voids the round (EV 0)
+//
+// Values come from dynamic programming over remaining-deck states. Every
+// (composition, player total, up-card) state is stored in a sharded
+// transposition table shared by all threads, so overlapping subtrees are
+// solved once however many threads are working.
+class StrategySolver {
+public:
+    StrategySolver();
+
+    // Thread-safe. `remaining` excludes the up-card and the player's cards
+    // but includes the dealer's unseen hole card.
+    ActionValues evaluate(int hardTotal, bool hasAce, int upIndex, const DeckComposition& remaining);
+    ActionValues evaluate(const Hand& player, Card dealerUp, const DeckComposition& remaining);
+
+    // The decision a player facing these hands sees: every dealer card but
+    // the up-card is still unseen, so it counts as part of the deck.
+    ActionValues evaluate(const Hand& player, const Hand& dealer, const Shoe& shoe);
+
+    template <typename Rng>
+    ActionValues evaluate(const BasicBlackjackEngine<Rng>& engine) {
+        return evaluate(engine.getPlayerHand(), engine.getDealerHand(), engine.getShoe());
+    }
+
+    size_t tableSize() const;
+    void clear();
+
+private:
+    struct Key {
+        std::uint64_t composition;
+        std::uint8_t hardTotal;
+        std::uint8_t hasAce;
+        std::uint8_t upIndex;
+        bool operator==(const Key& other) const {
+            return composition == other.composition && hardTotal == other.hardTotal &&
+                   hasAce == other.hasAce && upIndex == other.upIndex;
+        }
+    };
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+    struct alignas(64) Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<Key, ActionValues, KeyHash> entries;
+    };
+    static const size_t kShards = 64;
+
+    bool lookup(const Key& key, ActionValues& values) const;
+    void store(const Key& key, const ActionValues& values);
+    Shard& shardFor(size_t hash) const { return shards[(hash >> 58) & (kShards - 1)]; }
+
+    ActionValues solve(int hardTotal, bool hasAce, int upIndex, DeckComposition& remaining);
+
+    std::unique_ptr<Shard[]> shards;
+};
+
+// Basic strategy for fresh shoes: one entry per player hand class and
+// dealer up-card, solved with the depletion of the player's two cards.
+struct StrategyTable {
+    static const int kHardFirst = 5;
+    static const int kHardRows = 16;  // Hard 5-20
+    static const int kSoftFirst = 13;
+    static const int kSoftRows = 8;   // Soft 13-20
+
+    int decks = 1;
+    ActionValues hard[kHardRows][DeckComposition::kRanks];
+    ActionValues soft[kSoftRows][DeckComposition::kRanks];
+};
+
+// Fills every cell of the table in parallel (0 threads = one per core).
+StrategyTable solveBasicStrategy(StrategySolver& solver, int decks, int threads = 0);
+
+#endif
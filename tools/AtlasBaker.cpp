@@ -0,0 +1,131 @@
+// Packs every card image in assets/ (52 faces, 15 backs, the joker) into a
+// single atlas texture plus the slot table CardAtlas::load reads.
+//
+// Usage: AtlasBaker [--assets DIR] [--out DIR] [--scale S] [--columns N]
+//
+// Writes DIR/cardAtlas.png and DIR/cardAtlas.txt. Each cell is padded with
+// copies of its edge pixels so linear filtering never picks up a
+// neighbouring card. The game samples the atlas without mip levels, which
+// this padding would not protect past the first.
+
+#include "CardAtlas.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image/stb_image.h>
+#define STB_IMAGE_RESIZE_IMPLEMENTATION
+#include <stb_image/stb_image_resize2.h>
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image/stb_image_write.h>
+
+namespace {
+
+const int kChannels = 4;
+const int kPadding = 2; // Edge pixels repeated around every cell
+
+struct Image {
+    int width = 0;
+    int height = 0;
+    std::vector<unsigned char> pixels; // RGBA
+};
+
+bool loadImage(const std::string& path, Image& image) {
+    int channels;
+    unsigned char* data = stbi_load(path.c_str(), &image.width, &image.height, &channels, kChannels);
+    if (!data) {
+        std::cerr << "Failed to load " << path << ": " << stbi_failure_reason() << std::endl;
+        return false;
+    }
+    image.pixels.assign(data, data + static_cast<size_t>(image.width) * image.height * kChannels);
+    stbi_image_free(data);
+    return true;
+}
+
+// Copies `image` to (x, y) and extrudes its border into the padding
+void blit(const Image& image, std::vector<unsigned char>& atlas, int atlasWidth, int x, int y) {
+    for (int row = -kPadding; row < image.height + kPadding; ++row) {
+        int sourceRow = std::min(std::max(row, 0), image.height - 1);
+        for (int column = -kPadding; column < image.width + kPadding; ++column) {
+            int sourceColumn = std::min(std::max(column, 0), image.width - 1);
+            const unsigned char* source = &image.pixels[(static_cast<size_t>(sourceRow) * image.width + sourceColumn) * kChannels];
+            unsigned char* target = &atlas[(static_cast<size_t>(y + row) * atlasWidth + x + column) * kChannels];
+            std::memcpy(target, source, kChannels);
+        }
+    }
+}
+
+}
+
+int main(int argc, char** argv) {
+    std::string assets = "assets";
+    std::string out = "assets";
+    double scale = 1.0;
+    int columns = 10;
+
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--assets") && i + 1 < argc) assets = argv[++i];
+        else if (!std::strcmp(argv[i], "--out") && i + 1 < argc) out = argv[++i];
+        else if (!std::strcmp(argv[i], "--scale") && i + 1 < argc) scale = std::atof(argv[++i]);
+        else if (!std::strcmp(argv[i], "--columns") && i + 1 < argc) columns = std::atoi(argv[++i]);
+        else {
+            std::cerr << "Usage: AtlasBaker [--assets DIR] [--out DIR] [--scale S] [--columns N]" << std::endl;
+            return 1;
+        }
+    }
+    if (scale <= 0.0 || columns < 1) {
+        std::cerr << "scale must be positive and columns at least 1" << std::endl;
+        return 1;
+    }
+
+    // Every cell has the size of the first face scaled; other images are
+    // resized to match, so a stray odd-sized asset cannot break the grid.
+    std::vector<Image> images(CardAtlas::kSlots);
+    for (int slot = 0; slot < CardAtlas::kSlots; ++slot) {
+        if (!loadImage(assets + "/" + CardAtlas::slotName(slot) + ".png", images[slot])) return 1;
+    }
+    int cardWidth = static_cast<int>(images[0].width * scale + 0.5);
+    int cardHeight = static_cast<int>(images[0].height * scale + 0.5);
+    for (Image& image : images) {
+        if (image.width == cardWidth && image.height == cardHeight) continue;
+        Image resized;
+        resized.width = cardWidth;
+        resized.height = cardHeight;
+        resized.pixels.resize(static_cast<size_t>(cardWidth) * cardHeight * kChannels);
+        stbir_resize_uint8_srgb(image.pixels.data(), image.width, image.height, 0,
+                                resized.pixels.data(), cardWidth, cardHeight, 0, STBIR_RGBA);
+        image = std::move(resized);
+    }
+
+    int cellWidth = cardWidth + 2 * kPadding;
+    int cellHeight = cardHeight + 2 * kPadding;
+    int rows = (CardAtlas::kSlots + columns - 1) / columns;
+    int atlasWidth = columns * cellWidth;
+    int atlasHeight = rows * cellHeight;
+    std::vector<unsigned char> atlas(static_cast<size_t>(atlasWidth) * atlasHeight * kChannels, 0);
+
+    std::ofstream table(out + "/cardAtlas.txt");
+    table << "cardAtlas " << atlasWidth << " " << atlasHeight << " " << CardAtlas::kSlots << "\n";
+    for (int slot = 0; slot < CardAtlas::kSlots; ++slot) {
+        int x = (slot % columns) * cellWidth + kPadding;
+        int y = (slot / columns) * cellHeight + kPadding;
+        blit(images[slot], atlas, atlasWidth, x, y);
+        table << CardAtlas::slotName(slot) << " " << x << " " << y << " " << cardWidth << " " << cardHeight << "\n";
+    }
+    if (!table) {
+        std::cerr << "Failed to write " << out << "/cardAtlas.txt" << std::endl;
+        return 1;
+    }
+
+    std::string atlasPath = out + "/cardAtlas.png";
+    if (!stbi_write_png(atlasPath.c_str(), atlasWidth, atlasHeight, kChannels, atlas.data(), atlasWidth * kChannels)) {
+        std::cerr << "Failed to write " << atlasPath << std::endl;
+        return 1;
+    }
+    std::cout << "Packed " << CardAtlas::kSlots << " cards into " << atlasPath << " (" << atlasWidth << "x"
+              << atlasHeight << ")" << std::endl;
+    return 0;
+}
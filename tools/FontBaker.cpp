@@ -0,0 +1,203 @@
+// Bakes a TrueType font into the binary glyph atlas TextRenderer maps at
+// startup: signed distance fields for printable ASCII packed into one
+// atlas, plus advances, bearings and kerning pairs.
+//
+// Usage: FontBaker [--font FILE] [--out FILE] [--size PX] [--padding PX]
+
+#include "FontAtlasFormat.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <vector>
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <stb_image/stb_truetype.h>
+
+namespace {
+
+const int kFirstCodepoint = 32;
+const int kLastCodepoint = 126;
+const int kOnEdge = 128;
+const int kMaxAtlasWidth = 2048;
+
+struct BakedGlyph {
+    FontAtlasFormat::Glyph metrics;
+    std::vector<unsigned char> sdf;
+};
+
+// Shelf packing, tallest glyphs first, with a 1px gap so linear filtering
+// never reaches a neighbour. Every power-of-two width is tried and the
+// smallest atlas kept. Returns false if a glyph is wider than any atlas.
+bool pack(std::vector<BakedGlyph>& glyphs, int& atlasWidth, int& atlasHeight) {
+    const int gap = 1;
+    std::vector<size_t> order(glyphs.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return glyphs[a].metrics.height > glyphs[b].metrics.height;
+    });
+
+    atlasWidth = atlasHeight = 0;
+    std::vector<std::pair<int, int>> best;
+    for (int width = 64; width <= kMaxAtlasWidth; width *= 2) {
+        std::vector<std::pair<int, int>> placed(glyphs.size());
+        int penX = gap, penY = gap, shelfHeight = 0;
+        bool fits = true;
+        for (size_t index : order) {
+            const FontAtlasFormat::Glyph& glyph = glyphs[index].metrics;
+            if (glyph.width + 2 * gap > width) {
+                fits = false;
+                break;
+            }
+            if (penX + glyph.width + gap > width) {
+                penX = gap;
+                penY += shelfHeight + gap;
+                shelfHeight = 0;
+            }
+            placed[index] = { penX, penY };
+            penX += glyph.width + gap;
+            shelfHeight = std::max(shelfHeight, static_cast<int>(glyph.height));
+        }
+        int height = penY + shelfHeight + gap;
+        if (fits && (atlasWidth == 0 || width * height < atlasWidth * atlasHeight)) {
+            atlasWidth = width;
+            atlasHeight = height;
+            best.swap(placed);
+        }
+    }
+    if (atlasWidth == 0) return false;
+    for (size_t i = 0; i < glyphs.size(); ++i) {
+        glyphs[i].metrics.x = static_cast<std::uint16_t>(best[i].first);
+        glyphs[i].metrics.y = static_cast<std::uint16_t>(best[i].second);
+    }
+    return true;
+}
+
+// Pair adjustments from GPOS where stb_truetype can read it, otherwise
+// from the legacy kern table, which many fonts still carry alone
+std::vector<FontAtlasFormat::Kerning> kerningPairs(const stbtt_fontinfo& font, float scale) {
+    std::map<std::pair<int, int>, int> kernTable;
+    int length = stbtt_GetKerningTableLength(&font);
+    if (length > 0) {
+        std::vector<stbtt_kerningentry> entries(length);
+        stbtt_GetKerningTable(&font, entries.data(), length);
+        for (const stbtt_kerningentry& entry : entries) kernTable[{ entry.glyph1, entry.glyph2 }] = entry.advance;
+    }
+
+    std::vector<FontAtlasFormat::Kerning> pairs;
+    for (int first = kFirstCodepoint; first <= kLastCodepoint; ++first) {
+        for (int second = kFirstCodepoint; second <= kLastCodepoint; ++second) {
+            int advance = stbtt_GetCodepointKernAdvance(&font, first, second);
+            if (advance == 0) {
+                auto found = kernTable.find({ stbtt_FindGlyphIndex(&font, first), stbtt_FindGlyphIndex(&font, second) });
+                if (found != kernTable.end()) advance = found->second;
+            }
+            if (advance != 0) {
+                pairs.push_back({ static_cast<std::uint32_t>(first), static_cast<std::uint32_t>(second), advance * scale });
+            }
+        }
+    }
+    return pairs;
+}
+
+}
+
+int main(int argc, char** argv) {
+    std::string fontPath = "assets/font.ttf";
+    std::string outPath = "assets/fontAtlas.bin";
+    int pixelHeight = 32;
+    int padding = 4;
+
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--font") && i + 1 < argc) fontPath = argv[++i];
+        else if (!std::strcmp(argv[i], "--out") && i + 1 < argc) outPath = argv[++i];
+        else if (!std::strcmp(argv[i], "--size") && i + 1 < argc) pixelHeight = std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--padding") && i + 1 < argc) padding = std::atoi(argv[++i]);
+        else {
+            std::cerr << "Usage: FontBaker [--font FILE] [--out FILE] [--size PX] [--padding PX]" << std::endl;
+            return 1;
+        }
+    }
+    if (pixelHeight < 8 || pixelHeight > 256 || padding < 1 || padding > 32) {
+        std::cerr << "size must be 8-256 and padding 1-32" << std::endl;
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::ifstream file(fontPath, std::ios::binary);
+    std::vector<unsigned char> fontData((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    stbtt_fontinfo font;
+    if (fontData.empty() || !stbtt_InitFont(&font, fontData.data(), stbtt_GetFontOffsetForIndex(fontData.data(), 0))) {
+        std::cerr << "Failed to load font " << fontPath << std::endl;
+        return 1;
+    }
+    float scale = stbtt_ScaleForPixelHeight(&font, static_cast<float>(pixelHeight));
+
+    std::vector<BakedGlyph> glyphs;
+    for (int codepoint = kFirstCodepoint; codepoint <= kLastCodepoint; ++codepoint) {
+        BakedGlyph glyph = {};
+        int width = 0, height = 0, xoff = 0, yoff = 0;
+        unsigned char* sdf = stbtt_GetCodepointSDF(&font, scale, codepoint, padding, kOnEdge,
+                                                   static_cast<float>(kOnEdge) / padding, &width, &height, &xoff, &yoff);
+        if (sdf) {
+            glyph.sdf.assign(sdf, sdf + static_cast<size_t>(width) * height);
+            stbtt_FreeSDF(sdf, nullptr);
+        }
+        else {
+            width = height = xoff = yoff = 0; // Blank glyph such as space
+        }
+
+        int advance, leftSideBearing;
+        stbtt_GetCodepointHMetrics(&font, codepoint, &advance, &leftSideBearing);
+        glyph.metrics.codepoint = static_cast<std::uint32_t>(codepoint);
+        glyph.metrics.width = static_cast<std::uint16_t>(width);
+        glyph.metrics.height = static_cast<std::uint16_t>(height);
+        glyph.metrics.bearingX = static_cast<std::int16_t>(xoff);
+        glyph.metrics.bearingY = static_cast<std::int16_t>(-yoff);
+        glyph.metrics.advance = advance * scale;
+        glyphs.push_back(std::move(glyph));
+    }
+    std::vector<FontAtlasFormat::Kerning> kerning = kerningPairs(font, scale);
+
+    int atlasWidth, atlasHeight;
+    if (!pack(glyphs, atlasWidth, atlasHeight)) {
+        std::cerr << "Glyphs do not fit in a " << kMaxAtlasWidth << "px wide atlas" << std::endl;
+        return 1;
+    }
+    std::vector<unsigned char> pixels(static_cast<size_t>(atlasWidth) * atlasHeight, 0);
+    for (const BakedGlyph& glyph : glyphs) {
+        for (int row = 0; row < glyph.metrics.height; ++row) {
+            std::copy(glyph.sdf.begin() + row * glyph.metrics.width, glyph.sdf.begin() + (row + 1) * glyph.metrics.width,
+                      pixels.begin() + (glyph.metrics.y + row) * atlasWidth + glyph.metrics.x);
+        }
+    }
+
+    FontAtlasFormat::Header header;
+    std::memcpy(header.magic, FontAtlasFormat::kMagic, sizeof(header.magic));
+    header.version = FontAtlasFormat::kVersion;
+    header.pixelHeight = static_cast<std::uint32_t>(pixelHeight);
+    header.padding = static_cast<std::uint32_t>(padding);
+    header.onEdge = kOnEdge;
+    header.atlasWidth = static_cast<std::uint32_t>(atlasWidth);
+    header.atlasHeight = static_cast<std::uint32_t>(atlasHeight);
+    header.glyphCount = static_cast<std::uint32_t>(glyphs.size());
+    header.kerningCount = static_cast<std::uint32_t>(kerning.size());
+
+    std::ofstream out(outPath, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const BakedGlyph& glyph : glyphs) out.write(reinterpret_cast<const char*>(&glyph.metrics), sizeof(glyph.metrics));
+    out.write(reinterpret_cast<const char*>(kerning.data()), kerning.size() * sizeof(FontAtlasFormat::Kerning));
+    out.write(reinterpret_cast<const char*>(pixels.data()), pixels.size());
+    if (!out) {
+        std::cerr << "Failed to write " << outPath << std::endl;
+        return 1;
+    }
+
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Baked " << glyphs.size() << " glyphs and " << kerning.size() << " kerning pairs into " << outPath
+              << " (" << atlasWidth << "x" << atlasHeight << " atlas, " << out.tellp() << " bytes) in " << ms << " ms"
+              << std::endl;
+    return 0;
+}
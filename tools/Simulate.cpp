@@ -0,0 +1,67 @@
+// Monte Carlo house-edge estimate for the Game rules, spread across all cores.
+//
+// Usage: Simulate [--rounds N] [--seed S] [--threads T] [--stand-on V] [--decks D] [--penetration P] [--chunk C]
+//
+// The same seed always gives the same tallies, whatever --threads is.
+
+#include "Simulator.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+
+void printUsage() {
+    std::cerr << "Usage: Simulate [--rounds N] [--seed S] [--threads T] [--stand-on V] [--decks D] [--penetration P] [--chunk C]" << std::endl;
+}
+
+}
+
+int main(int argc, char** argv) {
+    SimulationConfig config;
+    config.rounds = 100000000ULL;
+
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 >= argc) {
+            printUsage();
+            return 1;
+        }
+        const char* value = argv[++i];
+        if (!std::strcmp(argv[i - 1], "--rounds")) config.rounds = std::strtoull(value, nullptr, 10);
+        else if (!std::strcmp(argv[i - 1], "--seed")) config.seed = std::strtoull(value, nullptr, 10);
+        else if (!std::strcmp(argv[i - 1], "--threads")) config.threads = std::atoi(value);
+        else if (!std::strcmp(argv[i - 1], "--stand-on")) config.playerStandsOn = std::atoi(value);
+        else if (!std::strcmp(argv[i - 1], "--decks")) config.decks = std::atoi(value);
+        else if (!std::strcmp(argv[i - 1], "--penetration")) config.penetration = std::atof(value);
+        else if (!std::strcmp(argv[i - 1], "--chunk")) config.roundsPerChunk = std::strtoull(value, nullptr, 10);
+        else {
+            printUsage();
+            return 1;
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    SimulationStats stats = simulate(config);
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    double edge = stats.houseEdge();
+    double error = stats.standardError();
+    double n = static_cast<double>(stats.rounds);
+
+    std::cout << std::fixed;
+    std::cout << "Rounds:       " << stats.rounds << " (" << stats.voided << " voided, " << stats.reshuffled
+              << " finished from reshuffled discards)" << std::endl;
+    std::cout << "Time:         " << std::setprecision(3) << seconds << " s" << std::endl;
+    std::cout << "Rounds/sec:   " << std::setprecision(0) << n / seconds << std::endl;
+    std::cout << std::setprecision(4);
+    std::cout << "Player wins:  " << stats.playerWins << " (" << 100.0 * stats.playerWins / n << "%)" << std::endl;
+    std::cout << "Dealer wins:  " << stats.dealerWins << " (" << 100.0 * stats.dealerWins / n << "%)" << std::endl;
+    std::cout << "Ties:         " << stats.ties << " (" << 100.0 * stats.ties / n << "%)" << std::endl;
+    std::cout << "House edge:   " << 100.0 * edge << "% +/- " << 100.0 * error << "% (1 s.e.)" << std::endl;
+    std::cout << "95% CI:       [" << 100.0 * (edge - 1.959964 * error) << "%, " << 100.0 * (edge + 1.959964 * error) << "%]" << std::endl;
+    std::cout << "99% CI:       [" << 100.0 * (edge - 2.575829 * error) << "%, " << 100.0 * (edge + 2.575829 * error) << "%]" << std::endl;
+    return 0;
+}
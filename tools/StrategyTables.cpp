@@ -0,0 +1,75 @@
+// Prints composition-dependent basic strategy (hit/stand) for the Game rules.
+//
+// Usage: StrategyTables [--decks N] [--threads T] [--ev]
+
+#include "StrategySolver.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+
+// Columns in the usual order: 2-9, T, A
+const int kColumns[DeckComposition::kRanks] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 0 };
+
+void printRow(const char* label, int total, const ActionValues* row, bool showEv) {
+    std::cout << label << std::setw(2) << total << " ";
+    for (int column : kColumns) {
+        const ActionValues& values = row[column];
+        if (showEv) {
+            std::cout << " " << std::setw(6) << std::showpos << std::setprecision(3) << values.best() << std::noshowpos
+                      << (values.bestAction() == Action::Hit ? 'H' : 'S');
+        }
+        else {
+            std::cout << "  " << (values.bestAction() == Action::Hit ? 'H' : 'S');
+        }
+    }
+    std::cout << std::endl;
+}
+
+}
+
+int main(int argc, char** argv) {
+    int decks = 1;
+    int threads = 0;
+    bool showEv = false;
+
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--decks") && i + 1 < argc) decks = std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--threads") && i + 1 < argc) threads = std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--ev")) showEv = true;
+        else {
+            std::cerr << "Usage: StrategyTables [--decks N] [--threads T] [--ev]" << std::endl;
+            return 1;
+        }
+    }
+    if (decks < 1 || decks > DeckComposition::kMaxDecks) {
+        std::cerr << "decks must be 1-" << DeckComposition::kMaxDecks << std::endl;
+        return 1;
+    }
+
+    StrategySolver solver;
+    auto start = std::chrono::steady_clock::now();
+    StrategyTable table = solveBasicStrategy(solver, decks, threads);
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout << std::fixed;
+    std::cout << decks << " deck(s): hit/stand only, hitting to 21 ends the round, dealer stands on 17" << std::endl;
+    std::cout << (showEv ? "         " : "     ");
+    for (const char* up : { "2", "3", "4", "5", "6", "7", "8", "9", "T", "A" }) {
+        std::cout << (showEv ? "       " : "  ") << up;
+    }
+    std::cout << std::endl;
+    for (int row = 0; row < StrategyTable::kHardRows; ++row) {
+        printRow("Hard ", StrategyTable::kHardFirst + row, table.hard[row], showEv);
+    }
+    for (int row = 0; row < StrategyTable::kSoftRows; ++row) {
+        printRow("Soft ", StrategyTable::kSoftFirst + row, table.soft[row], showEv);
+    }
+
+    std::cout << std::setprecision(3) << "Solved in " << std::chrono::duration<double>(end - start).count()
+              << " s, " << solver.tableSize() << " states in the transposition table" << std::endl;
+    return 0;
+}